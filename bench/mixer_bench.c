@@ -0,0 +1,155 @@
+#include "sfx_mixer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define DEFAULT_VOICES 48
+#define DEFAULT_FRAGMENTS 20000
+#define SOURCE_FRAMES SFX_MIXER_FREQUENCY
+
+/**
+ * @brief Configuração de uma execução do micro-benchmark.
+ */
+typedef struct MixerBenchConfig {
+    int voices;
+    long fragments;
+} MixerBenchConfig;
+
+/**
+ * @brief Retorna o tempo monotônico em segundos.
+ */
+double get_seconds() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Interpreta os argumentos da linha de comando do micro-benchmark.
+ *
+ * @return Bool indicando se todos os argumentos eram válidos.
+ */
+bool parse_mixer_bench_options(int argc, char **argv, MixerBenchConfig *cfg) {
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--voices=", 9) == 0)
+            cfg->voices = atoi(argv[i] + 9);
+        else if (strncmp(argv[i], "--fragments=", 12) == 0)
+            cfg->fragments = atol(argv[i] + 12);
+        else {
+            fprintf(stderr, "Usage: %s [--voices=N] [--fragments=N]\n", argv[0]);
+            return false;
+        }
+    }
+
+    if (cfg->voices <= 0 || cfg->voices > SFX_MIXER_VOICES || cfg->fragments <= 0) {
+        fprintf(stderr, "Voices must be between 1 and %d and fragments must be positive.\n", SFX_MIXER_VOICES);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Inicia todas as vozes em posições diferentes da fonte, assim nenhuma termina junto das outras.
+ */
+void start_bench_voices(SfxMixer *mixer, const MixerSource *source, int voices) {
+    for (int i = 0; i < voices; i++) {
+        play_mixer_voice(mixer, source, .8f, (float) i / voices * 2 - 1, 0);
+        mixer->voices[i].position = (unsigned int) ((long) i * SOURCE_FRAMES / voices);
+    }
+}
+
+/**
+ * @brief Compara um fragmento do mixer com uma soma escalar de referência.
+ *
+ * @return Maior diferença absoluta entre os dois.
+ */
+float get_mixer_error(const MixerSource *source, int voices) {
+    static SfxMixer mixer;
+    static float out[SFX_MIXER_FRAGMENT_FRAMES * SFX_MIXER_CHANNELS];
+    static float reference[SFX_MIXER_FRAGMENT_FRAMES * SFX_MIXER_CHANNELS];
+    float error = 0;
+
+    init_sfx_mixer(&mixer);
+    start_bench_voices(&mixer, source, voices);
+    memset(reference, 0, sizeof(reference));
+
+    for (int v = 0; v < voices; v++) {
+        MixerVoice *voice = &mixer.voices[v];
+
+        for (int i = 0; i < SFX_MIXER_FRAGMENT_FRAMES && voice->position + i < source->frames; i++) {
+            const float *frame = source->data + (voice->position + i) * SFX_MIXER_CHANNELS;
+
+            reference[i * 2] += frame[0] * voice->gain_left;
+            reference[i * 2 + 1] += frame[1] * voice->gain_right;
+        }
+    }
+
+    render_sfx_mixer(&mixer, out, SFX_MIXER_FRAGMENT_FRAMES);
+
+    for (int i = 0; i < SFX_MIXER_FRAGMENT_FRAMES * SFX_MIXER_CHANNELS; i++) {
+        float expected = fmaxf(-1.0f, fminf(1.0f, reference[i]));
+        error = fmaxf(error, fabsf(out[i] - expected));
+    }
+
+    return error;
+}
+
+/**
+ * @brief Micro-benchmark do mixer de software: mixa N vozes de um sample de um segundo em fragmentos 
+ * de SFX_MIXER_FRAGMENT_FRAMES frames e reporta quantas vozes (um fragmento de uma voz) são mixadas
+ * por milissegundo.
+ */
+int main(int argc, char **argv) {
+    MixerBenchConfig cfg = {.voices = DEFAULT_VOICES, .fragments = DEFAULT_FRAGMENTS};
+    static short pcm[SOURCE_FRAMES];
+    static float out[SFX_MIXER_FRAGMENT_FRAMES * SFX_MIXER_CHANNELS];
+    static SfxMixer mixer;
+    MixerSource source;
+    double checksum = 0;
+
+    if (!parse_mixer_bench_options(argc, argv, &cfg))
+        return -1;
+
+    for (int i = 0; i < SOURCE_FRAMES; i++)
+        pcm[i] = (short) (sinf(i * 440.0f * 2 * (float) M_PI / SFX_MIXER_FREQUENCY) * 8000);
+
+    create_mixer_source(&source, pcm, SOURCE_FRAMES, 1, MIXER_PCM_INT16, SFX_MIXER_FREQUENCY);
+    init_sfx_mixer(&mixer);
+
+    double start = get_seconds();
+
+    for (long f = 0; f < cfg.fragments; f++) {
+        if (get_active_mixer_voices(&mixer) < cfg.voices) {
+            init_sfx_mixer(&mixer);
+            start_bench_voices(&mixer, &source, cfg.voices);
+        }
+
+        render_sfx_mixer(&mixer, out, SFX_MIXER_FRAGMENT_FRAMES);
+        checksum += out[f % (SFX_MIXER_FRAGMENT_FRAMES * SFX_MIXER_CHANNELS)];
+    }
+
+    double elapsed_ms = (get_seconds() - start) * 1000;
+    double audio_ms = (double) cfg.fragments * SFX_MIXER_FRAGMENT_FRAMES * 1000 / SFX_MIXER_FREQUENCY;
+    double voice_fragments = (double) cfg.fragments * cfg.voices;
+
+    printf("{\n");
+    printf("  \"kernel\": \"%s\",\n", get_sfx_mixer_kernel());
+    printf("  \"voices\": %d,\n", cfg.voices);
+    printf("  \"fragments\": %ld,\n", cfg.fragments);
+    printf("  \"fragment_frames\": %d,\n", SFX_MIXER_FRAGMENT_FRAMES);
+    printf("  \"elapsed_ms\": %.3f,\n", elapsed_ms);
+    printf("  \"voices_mixed_per_ms\": %.1f,\n", voice_fragments / elapsed_ms);
+    printf("  \"realtime_factor\": %.1f,\n", audio_ms / elapsed_ms);
+    printf("  \"max_abs_error\": %g,\n", get_mixer_error(&source, cfg.voices));
+    printf("  \"checksum\": %.6f\n", checksum);
+    printf("}\n");
+
+    destroy_mixer_source(&source);
+
+    return 0;
+}
@@ -0,0 +1,397 @@
+#include "utils.h"
+#include "screen_config.h"
+#include "sound_manager.h"
+#include "state_manager.h"
+#include "playing_scene.h"
+#include "game_over_state.h"
+#include "game_context.h"
+#include "game_stuff.h"
+#include "allegro_stuff.h"
+#include "game_clock.h"
+#include "stage_manager.h"
+#include "autopilot.h"
+#include "sprite_cache.h"
+#include "screen_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <allegro5/allegro.h>
+
+#define DEFAULT_TICKS 3600
+#define DEFAULT_WARMUP_TICKS 120
+#define DEFAULT_SEED 1
+
+/**
+ * @brief Configuração de uma execução do benchmark.
+ */
+typedef struct BenchConfig {
+    int stage;
+    uint64_t seed;
+    long ticks;
+    long warmup;
+    bool audio;
+    bool draw;
+    bool check_allocs;
+} BenchConfig;
+
+/**
+ * @brief Contadores de alocação, preenchidos pelos wrappers de malloc/calloc/realloc/free
+ * (linkados com -Wl,--wrap).
+ */
+typedef struct AllocCounters {
+    uint64_t mallocs;
+    uint64_t callocs;
+    uint64_t reallocs;
+    uint64_t frees;
+    uint64_t bytes;
+} AllocCounters;
+
+/**
+ * @brief Alocações feitas dentro de update_game e draw_game nos ticks medidos, ticks em que a 
+ * partida troca de estado (fim de jogo, reinício do estágio) não contam.
+ */
+typedef struct TickAllocStats {
+    long ticks;
+    long allocating_ticks;
+    uint64_t allocations;
+    uint64_t max_per_tick;
+} TickAllocStats;
+
+static AllocCounters allocs;
+static TickAllocStats tick_allocs;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size) {
+    allocs.mallocs++;
+    allocs.bytes += size;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocs.callocs++;
+    allocs.bytes += count * size;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocs.reallocs++;
+    allocs.bytes += size;
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr) {
+    if (ptr) allocs.frees++;
+    __real_free(ptr);
+}
+
+/**
+ * @brief Retorna o total de alocações (malloc, calloc e realloc) feitas até agora.
+ *
+ * @return Quantidade de alocações.
+ */
+uint64_t get_alloc_count() {
+    return allocs.mallocs + allocs.callocs + allocs.reallocs;
+}
+
+/**
+ * @brief Printa no terminal as opções aceitas pelo benchmark.
+ *
+ * @param program Nome do executável.
+ */
+void print_bench_usage(const char *program) {
+    fprintf(stderr, "Usage: %s [--stage=N] [--seed=N] [--ticks=N] [--warmup=N] [--audio=0|1] [--draw=0|1] "
+        "[--check-allocs=0|1]\n", program);
+}
+
+/**
+ * @brief Interpreta os argumentos da linha de comando do benchmark.
+ *
+ * @param argc Quantidade de argumentos.
+ * @param argv Vetor de argumentos.
+ * @param cfg Ponteiro para a configuração a ser preenchida.
+ *
+ * @return Bool indicando se todos os argumentos eram válidos.
+ */
+bool parse_bench_options(int argc, char **argv, BenchConfig *cfg) {
+    for (int i = 1; i < argc; i++) {
+        char *value = strchr(argv[i], '=');
+
+        if (!value || !is_valid_number(value + 1) || value[1] == '\0') {
+            print_bench_usage(argv[0]);
+            return false;
+        }
+
+        value++;
+
+        if (strncmp(argv[i], "--stage=", 8) == 0)
+            cfg->stage = atoi(value);
+        else if (strncmp(argv[i], "--seed=", 7) == 0)
+            cfg->seed = strtoull(value, NULL, 10);
+        else if (strncmp(argv[i], "--ticks=", 8) == 0)
+            cfg->ticks = atol(value);
+        else if (strncmp(argv[i], "--warmup=", 9) == 0)
+            cfg->warmup = atol(value);
+        else if (strncmp(argv[i], "--audio=", 8) == 0)
+            cfg->audio = atoi(value) != 0;
+        else if (strncmp(argv[i], "--draw=", 7) == 0)
+            cfg->draw = atoi(value) != 0;
+        else if (strncmp(argv[i], "--check-allocs=", 15) == 0)
+            cfg->check_allocs = atoi(value) != 0;
+        else {
+            print_bench_usage(argv[0]);
+            return false;
+        }
+    }
+
+    if (cfg->stage < 0 || cfg->stage >= get_stage_count() || cfg->ticks <= 0) {
+        fprintf(stderr, "Stage must be between 0 and %d and ticks must be positive.\n",
+            get_stage_count() - 1);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Inicia (ou reinicia) a partida no estágio escolhido.
+ *
+ * @param cfg Ponteiro para a configuração do benchmark.
+ */
+void start_bench_stage(const BenchConfig *cfg) {
+    reset_game_context();
+    get_stage_manager()->current_stage = cfg->stage;
+    reset_autopilot();
+    set_game_state(STATE_PLAYING, true);
+}
+
+/**
+ * @brief Registra as alocações feitas em um tick da partida.
+ *
+ * @param count Quantidade de alocações feitas no tick.
+ */
+void count_tick_allocs(uint64_t count) {
+    tick_allocs.ticks++;
+    tick_allocs.allocations += count;
+
+    if (count == 0) return;
+
+    tick_allocs.allocating_ticks++;
+    if (count > tick_allocs.max_per_tick) tick_allocs.max_per_tick = count;
+}
+
+/**
+ * @brief Executa um tick da partida com os inputs do autopilot, reiniciando o estágio quando a
+ * partida acaba. As alocações feitas em update_game (e em draw_game, com --draw=1) são contadas 
+ * enquanto a partida continua no playing state.
+ *
+ * @param cfg Ponteiro para a configuração do benchmark.
+ *
+ * @return Bool indicando se o estágio foi reiniciado.
+ */
+bool run_bench_tick(const BenchConfig *cfg) {
+    run_autopilot(handle_game_input);
+    advance_game_clock(FPS);
+
+    uint64_t allocs_before = get_alloc_count();
+    update_game();
+
+    if (get_game_state() == STATE_PLAYING) {
+        if (cfg->draw) draw_game();
+        count_tick_allocs(get_alloc_count() - allocs_before);
+    }
+
+    flush_sound_requests();
+
+    if (get_game_state() == STATE_PLAYING) return false;
+
+    exit_game_over_state();
+    start_bench_stage(cfg);
+
+    return true;
+}
+
+/**
+ * @brief Função de comparação usada para ordenar os tempos dos ticks.
+ */
+int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Retorna o percentil de um vetor ordenado.
+ *
+ * @param sorted Vetor ordenado.
+ * @param count Tamanho do vetor.
+ * @param percentile Percentil desejado (0 a 100).
+ *
+ * @return Valor do percentil.
+ */
+double get_percentile(const double *sorted, long count, double percentile) {
+    long index = (long) (percentile / 100.0 * (count - 1) + 0.5);
+    return sorted[index];
+}
+
+/**
+ * @brief Printa o resultado do benchmark em JSON.
+ */
+void print_bench_report(const BenchConfig *cfg, double *tick_us, double total_seconds,
+        int restarts, const AllocCounters *counters) {
+    double sum = 0;
+
+    for (long i = 0; i < cfg->ticks; i++)
+        sum += tick_us[i];
+
+    qsort(tick_us, cfg->ticks, sizeof(double), compare_doubles);
+
+    printf("{\n");
+    printf("  \"stage\": %d,\n", cfg->stage);
+    printf("  \"seed\": %" PRIu64 ",\n", cfg->seed);
+    printf("  \"ticks\": %ld,\n", cfg->ticks);
+    printf("  \"warmup_ticks\": %ld,\n", cfg->warmup);
+    printf("  \"restarts\": %d,\n", restarts);
+    printf("  \"audio\": \"%s\",\n", is_null_audio_backend() ? "null" : "allegro");
+    printf("  \"sfx_plays\": {\"player_shoot\": %d, \"alien_shoot\": %d, \"alien_die\": %d, \"player_hit\": %d},\n",
+        get_sound_play_count(SFX_PLAYER_SHOOT), get_sound_play_count(SFX_ALIEN_SHOOT),
+        get_sound_play_count(SFX_ALIEN_DIE), get_sound_play_count(SFX_PLAYER_HIT));
+    printf("  \"tick_us\": {\"min\": %.3f, \"p50\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f},\n",
+        tick_us[0], get_percentile(tick_us, cfg->ticks, 50), get_percentile(tick_us, cfg->ticks, 99),
+        tick_us[cfg->ticks - 1], sum / cfg->ticks);
+    printf("  \"ticks_per_second\": %.1f,\n", total_seconds > 0 ? cfg->ticks / total_seconds : 0);
+    printf("  \"allocations\": {\"total\": %" PRIu64 ", \"malloc\": %" PRIu64 ", \"calloc\": %" PRIu64
+        ", \"realloc\": %" PRIu64 ", \"free\": %" PRIu64 ", \"bytes\": %" PRIu64 "}\n",
+        counters->mallocs + counters->callocs + counters->reallocs, counters->mallocs,
+        counters->callocs, counters->reallocs, counters->frees, counters->bytes);
+    printf("}\n");
+}
+
+/**
+ * @brief Roda todos os estágios por cfg->ticks ticks (após o warmup) e verifica que nenhum tick da 
+ * partida alocou memória.
+ *
+ * @param cfg Ponteiro para a configuração do benchmark, o estágio é sobrescrito.
+ *
+ * @return Bool indicando se nenhum estágio alocou memória durante a partida.
+ */
+bool run_alloc_check(BenchConfig *cfg) {
+    bool passed = true;
+
+    for (int stage = 0; stage < get_stage_count(); stage++) {
+        cfg->stage = stage;
+        start_bench_stage(cfg);
+
+        for (long i = 0; i < cfg->warmup; i++)
+            run_bench_tick(cfg);
+
+        memset(&tick_allocs, 0, sizeof(TickAllocStats));
+
+        for (long i = 0; i < cfg->ticks; i++)
+            run_bench_tick(cfg);
+
+        printf("stage %d: %ld of %ld ticks allocated (%" PRIu64 " allocations, max %" PRIu64 " per tick)\n",
+            stage, tick_allocs.allocating_ticks, tick_allocs.ticks, tick_allocs.allocations,
+            tick_allocs.max_per_tick);
+
+        if (tick_allocs.allocating_ticks > 0) passed = false;
+    }
+
+    printf("%s: allocations in update_game%s\n", passed ? "PASS" : "FAIL", 
+        cfg->draw ? " and draw_game" : "");
+
+    return passed;
+}
+
+/**
+ * @brief Benchmark headless: roda um estágio escolhido com uma seed fixa por N ticks, com inputs
+ * do autopilot, e reporta a distribuição do tempo por tick, ticks por segundo e alocações. Com 
+ * --check-allocs=1 roda todos os estágios e falha se algum tick da partida alocar memória.
+ */
+int main(int argc, char **argv) {
+    BenchConfig cfg = {
+        .stage = 0,
+        .seed = DEFAULT_SEED,
+        .ticks = DEFAULT_TICKS,
+        .warmup = DEFAULT_WARMUP_TICKS,
+        .audio = false,
+        .draw = false,
+        .check_allocs = false,
+    };
+    ALLEGRO_DISPLAY *display = NULL;
+    int restarts = 0;
+    int result = 0;
+
+    if (!parse_bench_options(argc, argv, &cfg))
+        return -1;
+
+    if (!cfg.audio)
+        use_null_audio_backend();
+
+    if (!init_all_necessary_allegro_components())
+        return -1;
+
+    // draw_game precisa de um display, só é criado quando o desenho também é medido.
+    if (cfg.draw && !(display = al_create_display(SCREEN_WIDTH, SCREEN_HEIGHT))) {
+        fprintf(stderr, "Failed to create display.\n");
+        return -1;
+    }
+
+    if (!init_game_components())
+        return -1;
+
+    double *tick_us = (double *) malloc(sizeof(double) * cfg.ticks);
+
+    if (!tick_us) {
+        fprintf(stderr, "Failed to create tick times array.\n");
+        return -1;
+    }
+
+    init_game_clock();
+    set_random_seed(cfg.seed);
+    load_sounds();
+    init_game_context();
+
+    if (cfg.check_allocs) {
+        result = run_alloc_check(&cfg) ? 0 : 1;
+    } else {
+        start_bench_stage(&cfg);
+
+        for (long i = 0; i < cfg.warmup; i++)
+            run_bench_tick(&cfg);
+
+        memset(&allocs, 0, sizeof(AllocCounters));
+        reset_sound_play_counts();
+        double start = al_get_time();
+
+        for (long i = 0; i < cfg.ticks; i++) {
+            double tick_start = al_get_time();
+
+            if (run_bench_tick(&cfg)) restarts++;
+
+            tick_us[i] = (al_get_time() - tick_start) * 1e6;
+        }
+
+        double total_seconds = al_get_time() - start;
+        AllocCounters counters = allocs;
+
+        print_bench_report(&cfg, tick_us, total_seconds, restarts, &counters);
+    }
+
+    exit_game_state(STATE_EXIT, false);
+    free(tick_us);
+    destroy_playing_session();
+    destroy_sound_bank();
+    destroy_screen_cache();
+    destroy_sprite_cache();
+    if (display) al_destroy_display(display);
+    destroy_game_context();
+
+    return result;
+}
@@ -45,7 +45,7 @@ typedef struct AlienConfig {
     char *sprite_path;
 } AlienConfig;
 
-Alien create_alien(AlienConfig cfg, int id, int animation_frames, float animation_interval);
+void init_alien(Alien *alien, AlienConfig cfg, int id, int animation_frames, float animation_interval);
 
 void move_alien_horizontal(Alien *alien, MoveDir mov_dir, int amount);
 
@@ -55,6 +55,4 @@ void kill_alien(Alien *alien);
 
 void draw_alien(Alien *alien);
 
-void destroy_alien(Alien *alien);
-
 #endif
\ No newline at end of file
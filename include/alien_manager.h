@@ -12,6 +12,7 @@
 
 typedef struct BulletManager BulletManager;
 typedef struct Alien Alien;
+typedef struct AlienFormationState AlienFormationState;
 
 /**
  * @brief Enumeração dos tipos de aliens disponíveis no game.
@@ -28,6 +29,7 @@ typedef enum AlienType {
 typedef struct AlienManager {
     Alien *aliens;
     BulletManager *bm;
+    int capacity;
     int count;
     int rows;
     int columns;
@@ -43,6 +45,8 @@ typedef struct AlienManager {
 
 AlienManager *create_alien_manager();
 
+void reserve_aliens(AlienManager *manager, int count);
+
 void init_alien_manager(AlienManager *manager, int rows, int columns, float move_interval, 
     float fire_interval);
 
@@ -60,6 +64,8 @@ void update_aliens(AlienManager *manager);
 
 void draw_aliens(AlienManager *manager);
 
-void destroy_alien_manager(AlienManager *manager);
+bool save_alien_formation_state(AlienManager *manager, AlienFormationState *state);
+
+void restore_alien_formation_state(AlienManager *manager, const AlienFormationState *state);
 
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 
 typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+typedef struct AnimatorState AnimatorState;
 
 /**
  * @brief Estrutura responsável por animar os sprites utilizados no game.
@@ -27,6 +28,8 @@ void draw_animated_sprite(ALLEGRO_BITMAP *sprite_sheet, Animator *a, float x, fl
 
 void reset_animation(Animator *animator);
 
-void destroy_animator(Animator * animator);
+void save_animator_state(Animator *animator, AnimatorState *state);
+
+void restore_animator_state(Animator *animator, const AnimatorState *state);
 
 #endif
\ No newline at end of file
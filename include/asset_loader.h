@@ -0,0 +1,35 @@
+#pragma once
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <stdbool.h>
+
+#define ASSET_LOADER_MAX_JOB 32
+
+typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+typedef struct ALLEGRO_THREAD ALLEGRO_THREAD;
+typedef struct ALLEGRO_MUTEX ALLEGRO_MUTEX;
+
+/**
+ * @brief Job de carregamento de sprites executado por um worker thread. O worker decodifica as 
+ * imagens em bitmaps de memória (o contexto de bitmap do thread não tem display) e a thread principal
+ * converte os bitmaps para vídeo e os entrega ao sprite cache quando o job termina.
+ */
+typedef struct AssetLoadJob {
+    const char *paths[ASSET_LOADER_MAX_JOB];
+    ALLEGRO_BITMAP *bitmaps[ASSET_LOADER_MAX_JOB];
+    int count;
+    int loaded;
+    ALLEGRO_THREAD *thread;
+    ALLEGRO_MUTEX *mutex;
+} AssetLoadJob;
+
+void start_asset_loading(const char **paths, int count);
+
+float get_asset_loading_progress();
+
+bool finish_asset_loading();
+
+void wait_asset_loading();
+
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef ASSET_PATHS_H
+#define ASSET_PATHS_H
+
+#define MENU_BG_PATH "../assets/images/bg/menu_bg.png"
+#define PLAYING_BG_PATH "../assets/images/bg/playing_bg.png"
+#define GAME_OVER_BG_PATH "../assets/images/bg/game_over_bg.png"
+#define SAVE_SCORE_BG_PATH "../assets/images/bg/save_score_bg.png"
+#define SCORE_RANK_BG_PATH "../assets/images/bg/score_rank_bg.png"
+
+#define PLAYER_SPRITE_PATH "../assets/images/sprites/player/player_sprite_sheet.png"
+#define PLAYER_BULLET_SPRITE_PATH "../assets/images/sprites/player/player_bullet.png"
+#define TOXIC_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/toxic_alien.png"
+#define RAGE_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/rage_alien.png"
+#define SPOOKY_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/spooky_alien.png"
+#define ALIEN_BULLET_SPRITE_PATH "../assets/images/sprites/alien/alien_bullet.png"
+#define UFO_SPRITE_PATH "../assets/images/sprites/alien/ufo.png"
+#define EXPLOSION_SPRITE_PATH "../assets/images/sprites/explosion.png"
+#define LIFE_ICON_ACTIVE_PATH "../assets/images/icons/player_life.png"
+#define LIFE_ICON_DEACTIVE_PATH "../assets/images/icons/player_life_low_opacity.png"
+
+#endif
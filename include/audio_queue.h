@@ -0,0 +1,56 @@
+#pragma once
+#ifndef AUDIO_QUEUE_H
+#define AUDIO_QUEUE_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define AUDIO_QUEUE_SIZE 256
+
+/**
+ * @brief Comandos que o game thread envia para o audio thread.
+ */
+typedef enum AudioCommandType {
+    AUDIO_PLAY_SOUND,
+    AUDIO_STOP_SOUND,
+    AUDIO_REWIND_SOUND,
+    AUDIO_FLUSH_SOUNDS,
+    AUDIO_PLAY_MUSIC,
+    AUDIO_STOP_MUSIC,
+    AUDIO_REWIND_MUSIC,
+    AUDIO_FADE_IN_MUSIC,
+    AUDIO_FADE_OUT_MUSIC,
+    AUDIO_UPDATE_FADES,
+} AudioCommandType;
+
+/**
+ * @brief Estrutura que representa um comando de áudio, o SoundID alvo, um valor opcional 
+ * (duração de fade, delta time) e o momento em que o comando foi enviado.
+ */
+typedef struct AudioCommand {
+    AudioCommandType type;
+    int id;
+    float value;
+    double timestamp;
+} AudioCommand;
+
+/**
+ * @brief Fila circular lock-free de um produtor (game thread) e um consumidor (audio thread).
+ * Cada índice só é escrito por um dos lados, então nenhum dos dois precisa esperar pelo outro.
+ */
+typedef struct AudioQueue {
+    AudioCommand commands[AUDIO_QUEUE_SIZE];
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;
+} AudioQueue;
+
+void init_audio_queue(AudioQueue *queue);
+
+bool push_audio_command(AudioQueue *queue, AudioCommand command);
+
+bool pop_audio_command(AudioQueue *queue, AudioCommand *command);
+
+unsigned int get_dropped_audio_commands(AudioQueue *queue);
+
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include <stdbool.h>
+#include <allegro5/allegro.h>
+
+#define AUTOPILOT_SWEEP_TICKS 90
+
+/**
+ * @brief Função que recebe os eventos gerados pelo autopilot.
+ */
+typedef void (*AutopilotEventHandler)(ALLEGRO_EVENT event);
+
+void reset_autopilot();
+
+void run_autopilot(AutopilotEventHandler handler);
+
+#endif
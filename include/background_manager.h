@@ -2,12 +2,16 @@
 #ifndef BACKGROUND_MANAGER_H
 #define BACKGROUND_MANAGER_H
 
+#define BACKGROUND_CACHE_SIZE 8
+
 typedef struct BackgroundManager BackgroundManager;
 
 BackgroundManager* create_background_manager();
 
 void init_background_manager(BackgroundManager *manager);
 
+void preload_backgrounds(BackgroundManager *manager);
+
 void load_background(BackgroundManager *manager, const char *path);
 
 void draw_background(BackgroundManager *manager);
@@ -0,0 +1,26 @@
+#pragma once
+#ifndef BITMAP_AUDIT_H
+#define BITMAP_AUDIT_H
+
+#include <stdbool.h>
+
+typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+
+/**
+ * @brief Estrutura que armazena o estado da auditoria de bitmaps, usada em debug para encontrar 
+ * bitmaps em memória (desenhados por software) no desenho de um frame.
+ */
+typedef struct BitmapAudit {
+    bool enabled;
+    long frame;
+    int memory_draws;
+    const char *first_label;
+} BitmapAudit;
+
+void enable_bitmap_audit();
+
+void audit_bitmap(ALLEGRO_BITMAP *bitmap, const char *label);
+
+void end_bitmap_audit_frame();
+
+#endif
@@ -52,6 +52,4 @@ void active_bullet(Bullet *bullet);
 
 void deactive_bullet(Bullet *bullet);
 
-void destroy_bullet(Bullet *bullet);
-
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 typedef struct Rect Rect;
 typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+typedef struct BulletPoolState BulletPoolState;
 
 /**
  * @brief Estrutura usada para gerenciar múltiplas balas (bullet pool).
@@ -18,14 +19,18 @@ typedef struct BulletManager {
 
 BulletManager * create_bullet_manager(int max, BulletConfig cfg, ALLEGRO_BITMAP * sprite);
 
+void reset_bullet_manager(BulletManager *manager);
+
 void fire_bullet(BulletManager * manager, Rect hitbox);
 
 void deactive_bullet_by_id(BulletManager * manager, int id);
 
-void destroy_bullet_manager(BulletManager * manager);
-
 void update_bullets(BulletManager * manager);
 
 void draw_bullets(BulletManager *manager);
 
+bool save_bullets_state(BulletManager *manager, BulletPoolState *state);
+
+void restore_bullets_state(BulletManager *manager, const BulletPoolState *state);
+
 #endif
\ No newline at end of file
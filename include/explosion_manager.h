@@ -5,17 +5,22 @@
 #include "utils.h"
 
 typedef struct ExplosionManager ExplosionManager;
+typedef struct ExplosionPoolState ExplosionPoolState;
 
 ExplosionManager* create_explosion_manager();
 
 void init_explosion_manager(ExplosionManager *manager, int max);
 
+void reset_explosion_manager(ExplosionManager *manager);
+
 void trigger_explosion(ExplosionManager *manager, Rect collider);
 
 void update_explosions(ExplosionManager *manager, double delta_time);
 
 void draw_explosions(ExplosionManager *manager);
 
-void destroy_explosion_manager(ExplosionManager *manager);
+bool save_explosions_state(ExplosionManager *manager, ExplosionPoolState *state);
+
+bool restore_explosions_state(ExplosionManager *manager, const ExplosionPoolState *state);
 
 #endif
\ No newline at end of file
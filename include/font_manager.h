@@ -6,6 +6,30 @@
 
 typedef struct ALLEGRO_FONT ALLEGRO_FONT;
 
+#define FONT_SIZES 3
+#define FONT_ATLAS_DIR "../assets/fonts/baked"
+#define FONT_ATLAS_FIRST_GLYPH 32
+#define FONT_ATLAS_LAST_GLYPH 126
+
+/**
+ * @brief Índices dos tamanhos de fonte em FontSpec.
+ */
+typedef enum FontSize {
+    FONT_SMALL,
+    FONT_MEDIUM,
+    FONT_LARGE,
+} FontSize;
+
+/**
+ * @brief Estrutura que descreve uma fonte TTF, o nome usado nos atlas pré-gerados e os tamanhos 
+ * (pequeno, médio e grande) em que ela é usada.
+ */
+typedef struct FontSpec {
+    const char *path;
+    const char *name;
+    int sizes[FONT_SIZES];
+} FontSpec;
+
 /**
  * @brief Estrutura reponsável por armazenar as fontes utilizadas pelo programa. 
  */
@@ -15,6 +39,10 @@ typedef struct FontManager {
     ALLEGRO_FONT *large_font;
 } FontManager;
 
+const FontSpec *get_font_specs(int *count);
+
+void get_font_atlas_path(char *path, const char *name, int size);
+
 bool init_font_manager();
 
 void destroy_font_manager();
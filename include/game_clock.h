@@ -0,0 +1,13 @@
+#pragma once
+#ifndef GAME_CLOCK_H
+#define GAME_CLOCK_H
+
+void init_game_clock();
+
+void advance_game_clock(double delta_time);
+
+double get_game_time();
+
+void set_game_time(double time);
+
+#endif
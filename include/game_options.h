@@ -0,0 +1,30 @@
+#pragma once
+#ifndef GAME_OPTIONS_H
+#define GAME_OPTIONS_H
+
+#include <stdbool.h>
+#include "sound_manager.h"
+
+/**
+ * @brief Estrutura que armazena as opções recebidas pela linha de comando.
+ */
+typedef struct GameOptions {
+    bool practice_mode;
+    const char *record_replay_path;
+    const char *verify_replay_path;
+    bool turbo;
+    int turbo_render_interval;
+    bool autopilot;
+    bool no_audio;
+    MusicMode music_mode;
+    bool software_sfx_mixer;
+    bool audit_bitmaps;
+    bool low_power;
+    const char *perf_log_path;
+} GameOptions;
+
+bool parse_game_options(int argc, char **argv);
+
+GameOptions *get_game_options();
+
+#endif
@@ -6,6 +6,8 @@
 
 void enter_game_over_state();
 
+void exit_game_over_state();
+
 void handle_game_over_input(ALLEGRO_EVENT event);
 
 void draw_game_over();
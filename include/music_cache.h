@@ -0,0 +1,44 @@
+#pragma once
+#ifndef MUSIC_CACHE_H
+#define MUSIC_CACHE_H
+
+#include <allegro5/allegro_audio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define MUSIC_CACHE_DIR "../cache"
+#define MUSIC_CACHE_MAGIC 0x4D43504F /* "OPCM" */
+#define MUSIC_CACHE_VERSION 1
+#define MUSIC_CACHE_HEADER_SIZE 64
+
+/**
+ * @brief Cabeçalho de um arquivo de cache PCM. Os samples decodificados ficam logo após o cabeçalho
+ * (em MUSIC_CACHE_HEADER_SIZE bytes), assim podem ser usados direto do arquivo mapeado em memória.
+ * O tamanho e a data de modificação do arquivo original invalidam o cache quando a música muda.
+ */
+typedef struct MusicCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t frequency;
+    uint32_t channels;
+    uint32_t depth;
+    uint32_t length;
+    uint64_t data_size;
+    uint64_t source_size;
+    int64_t source_mtime;
+} MusicCacheHeader;
+
+/**
+ * @brief Sample de música carregado do cache PCM, com o mapeamento que guarda seus dados.
+ */
+typedef struct CachedMusic {
+    ALLEGRO_SAMPLE *sample;
+    void *map;
+    size_t map_size;
+} CachedMusic;
+
+CachedMusic load_cached_music(const char *music_path);
+
+void release_cached_music(CachedMusic *cached);
+
+#endif
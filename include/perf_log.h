@@ -0,0 +1,17 @@
+#pragma once
+#ifndef PERF_LOG_H
+#define PERF_LOG_H
+
+#include <stdbool.h>
+
+#define PERF_LOG_INTERVAL 5.0
+
+bool open_perf_log(const char *path);
+
+bool is_perf_log_open();
+
+void write_perf_log(const char *section, const char *format, ...);
+
+void close_perf_log();
+
+#endif
@@ -13,6 +13,7 @@
 #include <allegro5/allegro_audio.h>
 
 typedef struct BulletManager BulletManager;
+typedef struct PlayerState PlayerState;
 
 /**
  * @brief Enumerção dos possíveis comando do player vindos do teclado. 
@@ -27,6 +28,10 @@ typedef enum PlayerInput{
     INPUT_STOP_SHOOT,
 } PlayerInput;
 
+#define PLAYER_INPUT_LEFT (1 << 0)
+#define PLAYER_INPUT_RIGHT (1 << 1)
+#define PLAYER_INPUT_SHOOT (1 << 2)
+
 /**
  * @brief Estrutura usada para representar o player.
  * */
@@ -59,12 +64,12 @@ typedef struct Player {
 
 Player * create_player(PlayerConfig cfg);
 
+void reset_player(Player *p, PlayerConfig cfg);
+
 void draw_player(Player *p);
 
 void update_player(Player *p);
 
-void destroy_player(Player *p);
-
 PlayerInput interpret_player_event(ALLEGRO_EVENT *ev);
 
 void handle_player_events(Player *p, PlayerInput input);
@@ -74,5 +79,13 @@ void hit_player(Player *p);
 void player_hits_enemy(Player *p, int points);
 
 void kill_player(Player *p);
+
+bool save_player_state(Player *p, PlayerState *state);
+
+void restore_player_state(Player *p, const PlayerState *state);
+
+unsigned char get_player_input_flags(Player *p);
+
+void set_player_input_flags(Player *p, unsigned char flags);
    
 #endif
\ No newline at end of file
@@ -4,9 +4,17 @@
 
 #include <allegro5/allegro.h>
 #include "utils.h"
+#include "state_manager.h"
+#include <stdint.h>
+
+typedef struct GameSnapshot GameSnapshot;
 
 void enter_playing_state();
 
+void exit_game_state(GameState new_state, bool enter_state);
+
+void destroy_playing_session();
+
 void update_game();
 
 void handle_game_input(ALLEGRO_EVENT event);
@@ -15,4 +23,12 @@ void on_kill_enemy(Rect collider);
 
 void draw_game();
 
+bool save_playing_scene(GameSnapshot *snapshot);
+
+bool restore_playing_scene(const GameSnapshot *snapshot);
+
+void set_playing_input(unsigned char flags);
+
+uint64_t get_state_hash();
+
 #endif  
\ No newline at end of file
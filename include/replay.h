@@ -0,0 +1,50 @@
+#pragma once
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REPLAY_MAGIC 0x5244494FU
+#define REPLAY_VERSION 1
+
+/**
+ * @brief Tipos de registros gravados em um arquivo de replay.
+ */
+typedef enum ReplayRecordType {
+    REPLAY_RECORD_SEGMENT = 'S',
+    REPLAY_RECORD_TICK = 'T',
+} ReplayRecordType;
+
+/**
+ * @brief Cabeçalho de um segmento do replay, gravado cada vez que o playing state é iniciado,
+ * contém tudo que é necessário para recriar o estágio de forma determinística.
+ */
+typedef struct ReplaySegment {
+    int current_stage;
+    float move_interval_multiplier;
+    float fire_rate_multiplier;
+    int player_score;
+    uint64_t rng_state;
+    double game_time;
+} ReplaySegment;
+
+/**
+ * @brief Registro de um tick do replay, comandos do player e hash do estado após o tick.
+ */
+typedef struct ReplayTick {
+    unsigned char input;
+    uint64_t state_hash;
+} ReplayTick;
+
+bool start_replay_recording(const char *path);
+
+void record_replay_segment();
+
+void record_replay_tick(unsigned char input, uint64_t state_hash);
+
+void stop_replay_recording();
+
+int verify_replay(const char *path);
+
+#endif
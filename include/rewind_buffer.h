@@ -0,0 +1,23 @@
+#pragma once
+#ifndef REWIND_BUFFER_H
+#define REWIND_BUFFER_H
+
+#include <stdbool.h>
+
+#define REWIND_SECONDS 10
+#define REWIND_MAX_FRAMES (REWIND_SECONDS * 60)
+#define REWIND_BUFFER_BYTES (256 * 1024)
+
+typedef struct GameSnapshot GameSnapshot;
+
+void clear_rewind_buffer();
+
+void push_rewind_frame(const GameSnapshot *snapshot);
+
+bool rewind_frame(GameSnapshot *snapshot);
+
+int get_rewind_frame_count();
+
+int get_rewind_bytes_used();
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+#ifndef SCREEN_CACHE_H
+#define SCREEN_CACHE_H
+
+#include <stdbool.h>
+
+typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+
+/**
+ * @brief Função que desenha as camadas estáticas de uma tela (background, overlay e textos fixos).
+ */
+typedef void (*StaticLayersDrawer)();
+
+/**
+ * @brief Bitmap do tamanho da tela com as camadas estáticas da tela ativa já compostas. Só uma tela 
+ * estática fica ativa por vez, então o bitmap é compartilhado e redesenhado quando a tela muda 
+ * (outro drawer) ou quando é invalidado.
+ */
+typedef struct ScreenCache {
+    ALLEGRO_BITMAP *bitmap;
+    StaticLayersDrawer drawer;
+    bool dirty;
+} ScreenCache;
+
+void invalidate_screen_cache();
+
+void draw_screen_cache(StaticLayersDrawer drawer);
+
+void destroy_screen_cache();
+
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+#ifndef SESSION_ARENA_H
+#define SESSION_ARENA_H
+
+#include <stddef.h>
+
+#define SESSION_ARENA_SIZE (64 * 1024)
+
+/**
+ * @brief Arena (bump allocator) que guarda toda a memória da sessão de jogo: player, pools de balas,
+ * formação de aliens, UFO, explosões e seus animators. O bloco é alocado uma única vez e as 
+ * alocações só avançam used; nada é liberado individualmente, a sessão inteira é descartada com 
+ * reset_session_arena.
+ */
+typedef struct SessionArena {
+    unsigned char *memory;
+    size_t size;
+    size_t used;
+    size_t peak;
+} SessionArena;
+
+void *session_alloc(size_t size);
+
+void reset_session_arena();
+
+size_t get_session_arena_peak();
+
+void destroy_session_arena();
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+#ifndef SFX_MIXER_H
+#define SFX_MIXER_H
+
+#include <stdbool.h>
+
+#define SFX_MIXER_FREQUENCY 44100
+#define SFX_MIXER_CHANNELS 2
+#define SFX_MIXER_VOICES 64
+#define SFX_MIXER_FRAGMENT_FRAMES 256
+#define SFX_MIXER_BUFFERS 4
+
+/**
+ * @brief Formatos de PCM aceitos na conversão de um sample para o mixer.
+ */
+typedef enum MixerPcmFormat {
+    MIXER_PCM_INT8,
+    MIXER_PCM_UINT8,
+    MIXER_PCM_INT16,
+    MIXER_PCM_FLOAT32,
+} MixerPcmFormat;
+
+/**
+ * @brief Sample convertido para o formato do mixer: float estéreo intercalado na frequência 
+ * SFX_MIXER_FREQUENCY.
+ */
+typedef struct MixerSource {
+    float *data;
+    unsigned int frames;
+} MixerSource;
+
+/**
+ * @brief Uma voz do mixer, reproduz um MixerSource do início ao fim com ganho por canal.
+ */
+typedef struct MixerVoice {
+    const MixerSource *source;
+    unsigned int position;
+    float gain_left;
+    float gain_right;
+    int priority;
+    unsigned long started;
+    bool active;
+} MixerVoice;
+
+/**
+ * @brief Mixer de software dos efeitos sonoros, soma todas as vozes ativas em um único buffer de saída
+ * usando kernels SSE (ou AVX, compilando com -mavx) e uma versão escalar nas outras arquiteturas.
+ */
+typedef struct SfxMixer {
+    MixerVoice voices[SFX_MIXER_VOICES];
+    unsigned long started;
+} SfxMixer;
+
+bool create_mixer_source(MixerSource *source, const void *pcm, unsigned int frames, 
+    unsigned int channels, MixerPcmFormat format, unsigned int frequency);
+
+void destroy_mixer_source(MixerSource *source);
+
+void init_sfx_mixer(SfxMixer *mixer);
+
+bool play_mixer_voice(SfxMixer *mixer, const MixerSource *source, float gain, float pan, int priority);
+
+void stop_mixer_source(SfxMixer *mixer, const MixerSource *source);
+
+void rewind_mixer_source(SfxMixer *mixer, const MixerSource *source);
+
+int get_active_mixer_voices(const SfxMixer *mixer);
+
+void mix_voice_stereo(float *out, const float *in, unsigned int frames, float gain_left, float gain_right);
+
+void clamp_mixer_output(float *out, unsigned int frames);
+
+void render_sfx_mixer(SfxMixer *mixer, float *out, unsigned int frames);
+
+const char *get_sfx_mixer_kernel();
+
+#endif
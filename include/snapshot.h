@@ -0,0 +1,133 @@
+#pragma once
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "utils.h"
+#include "stage_manager.h"
+
+#define SNAPSHOT_MAX_ALIENS 64
+#define SNAPSHOT_MAX_BULLETS 8
+#define SNAPSHOT_MAX_EXPLOSIONS 16
+
+/**
+ * @brief Estado mutável de um Animator.
+ */
+typedef struct AnimatorState {
+    int current_frame;
+    double last_update;
+} AnimatorState;
+
+/**
+ * @brief Estado mutável de uma bala.
+ */
+typedef struct BulletState {
+    Point pos;
+    bool is_active;
+} BulletState;
+
+/**
+ * @brief Estado mutável de um BulletManager (bullet pool).
+ */
+typedef struct BulletPoolState {
+    BulletState bullets[SNAPSHOT_MAX_BULLETS];
+    int max;
+    int quantity;
+} BulletPoolState;
+
+/**
+ * @brief Estado mutável do player.
+ */
+typedef struct PlayerState {
+    Point pos;
+    float acc;
+    float vx;
+    bool move_left;
+    bool move_right;
+    bool is_shooting;
+    bool is_alive;
+    int lifes;
+    int score;
+    float last_fire_time;
+    AnimatorState animator;
+    BulletPoolState bullets;
+} PlayerState;
+
+/**
+ * @brief Estado mutável de um alien.
+ */
+typedef struct AlienState {
+    Point pos;
+    bool is_alive;
+    AnimatorState animator;
+} AlienState;
+
+/**
+ * @brief Estado mutável da formação de aliens (AlienManager).
+ */
+typedef struct AlienFormationState {
+    AlienState aliens[SNAPSHOT_MAX_ALIENS];
+    int count;
+    int alives;
+    MoveDir mov_dir;
+    double last_move_time;
+    float last_fire_time;
+    BulletPoolState bullets;
+} AlienFormationState;
+
+/**
+ * @brief Estado mutável do UFO.
+ */
+typedef struct UFOState {
+    Point pos;
+    float speed;
+    MoveDir mov_dir;
+    bool is_active;
+    int points;
+    double last_spawn;
+    AnimatorState animator;
+} UFOState;
+
+/**
+ * @brief Estado mutável de uma explosão.
+ */
+typedef struct ExplosionState {
+    Point pos;
+    float timer;
+    bool active;
+    AnimatorState animator;
+} ExplosionState;
+
+/**
+ * @brief Estado mutável do ExplosionManager.
+ */
+typedef struct ExplosionPoolState {
+    ExplosionState explosions[SNAPSHOT_MAX_EXPLOSIONS];
+    int max;
+    int count;
+} ExplosionPoolState;
+
+/**
+ * @brief Cópia plana (sem ponteiros) de todo o estado mutável da simulação, pode ser
+ * copiada com memcpy, comparada byte a byte ou escrita diretamente em um arquivo.
+ */
+typedef struct GameSnapshot {
+    double game_time;
+    uint64_t rng_state;
+    int player_score;
+    bool is_game_over;
+    bool player_win;
+    StageManager stage;
+    double last_update;
+    PlayerState player;
+    AlienFormationState formation;
+    UFOState ufo;
+    ExplosionPoolState explosions;
+} GameSnapshot;
+
+bool odi_snapshot_save(GameSnapshot *snapshot);
+
+bool odi_snapshot_restore(const GameSnapshot *snapshot);
+
+#endif
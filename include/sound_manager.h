@@ -3,9 +3,15 @@
 #define SOUND_MANGER_H
 
 #include <allegro5/allegro_audio.h>
+#include "music_cache.h"
+#include "sfx_mixer.h"
 #include <stdbool.h>
 #include <limits.h>
 
+#define SFX_VOICES 4
+#define SFX_VOICE_BUDGET 12
+#define MUSIC_FADE_TIME .5
+
 /**
  * @brief Enumeração dos sons e músicas disponíveis no game. 
  */
@@ -21,42 +27,117 @@ typedef enum SoundID {
     SFX_UFO,
     CALM_MUSIC,
     SFX_GAME_OVER,
+    SOUND_COUNT,
 } SoundID;
 
 /**
- * @brief Estrutura utilizada para encapsular um ALLEGRO_SMAPLE.
+ * @brief Tipo de um som da tabela de assets.
+ */
+typedef enum SoundKind {
+    SOUND_SFX,
+    SOUND_MUSIC,
+} SoundKind;
+
+/**
+ * @brief Entrada da tabela de assets de som: caminho do arquivo e metadados usados no carregamento 
+ * e na reprodução (prioridade e limite de vozes só se aplicam a efeitos sonoros).
+ */
+typedef struct SoundAsset {
+    SoundKind kind;
+    const char *path;
+    int priority;
+    float gain;
+    int max_voices;
+} SoundAsset;
+
+/**
+ * @brief Modos de carregamento das músicas. 
+ * MUSIC_STREAMED: decodifica a música aos poucos durante a reprodução (menor uso de memória).
+ * MUSIC_DECODED: decodifica a música inteira no carregamento e reproduz da memória.
+ * MUSIC_PCM_CACHE: como MUSIC_DECODED, mas os samples decodificados são gravados em disco e 
+ * mapeados em memória nas próximas execuções, sem decodificar de novo.
+ */
+typedef enum MusicMode {
+    MUSIC_STREAMED,
+    MUSIC_DECODED,
+    MUSIC_PCM_CACHE,
+} MusicMode;
+
+/**
+ * @brief Estrutura utilizada para encapsular um ALLEGRO_SMAPLE e as vozes (ALLEGRO_SAMPLE_INSTANCE)
+ * pré-alocadas que o reproduzem, assim tocar, parar e reiniciar um efeito não fazem I/O. Com o mixer
+ * de software ativo o efeito é reproduzido pelo SfxMixer a partir de mixed e não tem vozes próprias.
  */
 typedef struct SFX {
     ALLEGRO_SAMPLE *sfx;
     char path[PATH_MAX];
-    ALLEGRO_SAMPLE_ID id;
+    ALLEGRO_SAMPLE_INSTANCE *voices[SFX_VOICES];
+    MixerSource mixed;
+    int next_voice;
+    int priority;
+    int max_voices;
+    float gain;
 } SFX;
 
 /**
- * @brief Estrutura utilizada para encapsular um ALLEGRO_AUDIO_STREAM.
+ * @brief Estrutura utilizada para encapsular uma música, reproduzida por um ALLEGRO_AUDIO_STREAM 
+ * ou, nos modos pré-decodificados, por um ALLEGRO_SAMPLE_INSTANCE. A stream/instância fica conectada
+ * ao mixer durante todo o programa e é controlada somente por play/pause, seek e ganho.
  */
 typedef struct Music {
     ALLEGRO_AUDIO_STREAM *music;
+    ALLEGRO_SAMPLE_INSTANCE *instance;
+    CachedMusic decoded;
     char path[PATH_MAX];
+    float volume;
+    float gain;
+    float target_gain;
+    float fade_speed;
 } Music;
 
 /**
- * @brief Estrutura utilizada para armazenar todos os sons e músicas utilizados. 
+ * @brief Estatísticas da stream de uma música, amostradas pelo audio thread. Um refill é um fragmento 
+ * preenchido de novo pelo decoder e um underrun é quando a stream tocando fica sem nenhum fragmento
+ * preenchido (o que causa estalos no som).
+ */
+typedef struct MusicStreamStats {
+    unsigned long refills;
+    unsigned long underruns;
+    int min_queued_fragments;
+    unsigned long refill_intervals;
+    double max_refill_interval;
+    double total_refill_interval;
+} MusicStreamStats;
+
+/**
+ * @brief Estatísticas do sistema de som. As estatísticas de stream são indexadas por SoundID e a
+ * latência é o tempo entre a chamada de play_sound e o início da reprodução do sample.
+ */
+typedef struct AudioStats {
+    MusicStreamStats streams[SOUND_COUNT];
+    unsigned long sounds_started;
+    double total_start_latency;
+    double max_start_latency;
+    unsigned int dropped_commands;
+} AudioStats;
+
+/**
+ * @brief Estrutura utilizada para armazenar todos os sons e músicas utilizados, indexados por SoundID.
+ * Cada SoundID tem um SFX ou uma Music, de acordo com a tabela de assets.
  */
 typedef struct SoundBank {
-    SFX *player_shoot;
-    SFX *player_hit;
-    SFX *alien_shoot;
-    SFX *alien_die;
-    SFX *ufo_take_off;
-    SFX *game_win;
-    SFX *hit_ufo;
-    Music *playing_bg;
-    Music *title_screen;
-    Music *calm_music;
-    SFX *game_over;
+    SFX *sfx[SOUND_COUNT];
+    Music *music[SOUND_COUNT];
 } SoundBank;
 
+void use_null_audio_backend();
+
+void set_music_mode(MusicMode mode);
+
+void use_software_sfx_mixer();
+
+bool is_null_audio_backend();
+
 bool init_sound_manager();
 
 void play_sound(SoundID id);
@@ -71,8 +152,34 @@ void remove_music(SoundID id);
 
 void load_sounds();
 
+void start_audio_thread();
+
+void stop_audio_thread();
+
 void rewind_sound(SoundID id);
 
 void remove_sound(SoundID id);
 
+void fade_in_music(SoundID id, double seconds);
+
+void fade_out_music(SoundID id, double seconds);
+
+void crossfade_music(SoundID from, SoundID to, double seconds);
+
+void update_music_fades(double delta_time);
+
+bool has_pending_music_fades();
+
+void flush_sound_requests();
+
+int get_active_sfx_voices();
+
+int get_sound_play_count(SoundID id);
+
+void reset_sound_play_counts();
+
+AudioStats get_audio_stats();
+
+void write_audio_stats_to_perf_log();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <stdbool.h>
+#include <limits.h>
+
+#define SPRITE_CACHE_SIZE 32
+
+typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
+
+/**
+ * @brief Entrada do cache de sprites, um bitmap carregado e o caminho de onde ele veio.
+ */
+typedef struct CachedSprite {
+    char path[PATH_MAX];
+    ALLEGRO_BITMAP *bitmap;
+} CachedSprite;
+
+/**
+ * @brief Cache dos sprites do game. Cada imagem é carregada uma única vez e o bitmap é compartilhado
+ * por todos que o usam (aliens, balas, explosões...), que não devem destruí-lo. Os sprites ficam 
+ * residentes até destroy_sprite_cache.
+ */
+typedef struct SpriteCache {
+    CachedSprite sprites[SPRITE_CACHE_SIZE];
+    int count;
+} SpriteCache;
+
+bool is_sprite_cached(const char *path);
+
+void add_sprite(const char *path, ALLEGRO_BITMAP *bitmap);
+
+ALLEGRO_BITMAP *get_sprite(const char *path);
+
+void destroy_sprite_cache();
+
+#endif
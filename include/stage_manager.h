@@ -30,4 +30,8 @@ void next_stage(StageManager *stage_manager);
 
 void reset_stage_manager(StageManager *stage_manager);
 
+int get_stage_count();
+
+int get_max_stage_aliens();
+
 #endif
\ No newline at end of file
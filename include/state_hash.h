@@ -0,0 +1,11 @@
+#pragma once
+#ifndef STATE_HASH_H
+#define STATE_HASH_H
+
+#include <stdint.h>
+
+typedef struct GameSnapshot GameSnapshot;
+
+uint64_t hash_game_snapshot(const GameSnapshot *snapshot);
+
+#endif
@@ -8,6 +8,7 @@
 
 typedef struct ALLEGRO_BITMAP ALLEGRO_BITMAP;
 typedef struct Animator Animator;
+typedef struct UFOState UFOState;
 
 /**
  * @brief Estrutura utilizada para representar um UFO. 
@@ -31,14 +32,18 @@ typedef struct UFO {
 
 UFO * create_ufo();
 
+void init_ufo(UFO *ufo);
+
 void update_ufo(UFO *ufo);
 
 void draw_ufo(UFO *ufo);
 
-void destroy_ufo(UFO *ufo);
-
 void deactive_ufo(UFO *ufo);
 
 void kill_ufo(UFO *ufo);
 
+void save_ufo_state(UFO *ufo, UFOState *state);
+
+void restore_ufo_state(UFO *ufo, const UFOState *state);
+
 #endif
\ No newline at end of file
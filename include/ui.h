@@ -9,7 +9,20 @@
 #include "utils.h"
 
 /**
- * @brief Estrutura que representa a interface de usuário (UI). 
+ * @brief Valores mostrados pela HUD, usados para saber quando ela precisa ser redesenhada.
+ */
+typedef struct HudState {
+    int stage;
+    int max_score;
+    int player_score;
+    int max_lifes;
+    int lifes;
+} HudState;
+
+/**
+ * @brief Estrutura que representa a interface de usuário (UI). A HUD é desenhada em um bitmap 
+ * fora da tela (hud) somente quando algum valor de hud_state muda, e a cada frame apenas esse 
+ * bitmap é desenhado.
  * */
 typedef struct UI {
     ALLEGRO_COLOR text_color;
@@ -17,6 +30,9 @@ typedef struct UI {
     Rect wrapper;
     ALLEGRO_BITMAP *life_icon_active;
     ALLEGRO_BITMAP *life_icon_deactive;   
+    ALLEGRO_BITMAP *hud;
+    HudState hud_state;
+    bool hud_dirty;
 } UI;
 
 void init_ui(); 
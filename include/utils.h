@@ -5,6 +5,12 @@
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_font.h>
 #include <stdlib.h>
+#include <stdint.h>
+
+#define RNG_DEFAULT_SEED 0x9E3779B97F4A7C15ULL
+#define TEXT_LAYOUT_CACHE_SIZE 16
+#define TEXT_LAYOUT_MAX_TEXT 1024
+#define TEXT_LAYOUT_MAX_LINES 32
 
 /**
  * @brief Enumeração que representa as direções utilizadas no game. 
@@ -33,6 +39,22 @@ typedef struct RGB {
     int red, green, blue;
 } RGB;
 
+/**
+ * @brief Quebra de linhas de um texto desenhado por draw_wrapped_text, calculada uma vez para 
+ * cada combinação de fonte, texto, largura máxima e espaçamento. As linhas ficam em lines, 
+ * separadas por '\0', começando em line_starts e desenhadas em line_offsets (relativo ao y inicial).
+ */
+typedef struct TextLayout {
+    const ALLEGRO_FONT *font;
+    float max_width;
+    int gap;
+    char text[TEXT_LAYOUT_MAX_TEXT];
+    char lines[TEXT_LAYOUT_MAX_TEXT * 2];
+    int line_starts[TEXT_LAYOUT_MAX_LINES];
+    float line_offsets[TEXT_LAYOUT_MAX_LINES];
+    int line_count;
+} TextLayout;
+
 /**
  * @brief Estrutura que representa um retângulo. 
  */
@@ -51,10 +73,16 @@ float random_float();
 
 void set_time_seed();
 
-ALLEGRO_BITMAP *get_sprite(const char *path);
+void set_random_seed(uint64_t seed);
+
+uint64_t get_random_state();
+
+void set_random_state(uint64_t state);
 
 bool key_pressed(ALLEGRO_EVENT ev, int key_code);
 
+bool key_released(ALLEGRO_EVENT ev, int key_code);
+
 bool close_display(ALLEGRO_EVENT event);
 
 void draw_screen_overlay(RGB color, unsigned char alpha);
@@ -6,29 +6,30 @@
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_image.h>
 #include "sound_manager.h"
+#include "sprite_cache.h"
+#include "session_arena.h"
 
 /**
- * @brief Cria e inicializa um novo alien com base na configuração forncedia.
+ * @brief Inicializa um alien com base na configuração forncedia. O animator do alien é reaproveitado 
+ * se já existir, assim um mesmo slot da formação pode ser reinicializado a cada estágio sem alocar. 
+ * Novos animators vêm da arena da sessão.
  *     
+ * @param alien Ponteiro para o alien, animator deve ser NULL ou um animator já alocado.
  * @param cfg Estrutura de configuração do alien.
  * @param id Identificação do alien.    
  * @param animation_frames Número de frames da animação. 
  * @param animation_interval Tempo em quadros da animação.
- * 
- * @return Alien.
  */
-Alien create_alien(AlienConfig cfg, int id, int animation_frames, float animation_interval) {
-    Animator * animator = (Animator *) malloc(sizeof(Animator));
+void init_alien(Alien *alien, AlienConfig cfg, int id, int animation_frames, float animation_interval) {
+    Animator * animator = alien->animator;
 
-    if (animator == NULL) {
-        fprintf(stderr, "Failed to create animator.\n");
-        exit(-1);
-    }
+    if (!animator)
+        animator = (Animator *) session_alloc(sizeof(Animator));
     
     init_animator(animator, animation_frames, 
         cfg.width, cfg.height, animation_interval, true);
 
-    Alien alien = {
+    *alien = (Alien) {
         .animator = animator,
         .pos = cfg.pos,
         .width = cfg.width,
@@ -42,8 +43,6 @@ Alien create_alien(AlienConfig cfg, int id, int animation_frames, float animatio
         .sprite_sheet = get_sprite(cfg.sprite_path),
         .points = cfg.points,
     };
-    
-    return alien;
 }
 
 /**
@@ -91,13 +90,3 @@ void kill_alien(Alien *alien) {
     play_sound(SFX_ALIEN_DIE);
 }
 
-/**
- * @brief Libera os recursos utilizados pelo alien.
- * 
- * @param alien Ponteiro para o alien.
- */
-void destroy_alien(Alien *alien) {
-    if (!alien) return;
-    al_destroy_bitmap(alien->sprite_sheet);
-    destroy_animator(alien->animator);
-}
@@ -1 +1,534 @@
-#include "alien_manager.h"#include "alien.h"#include <stdlib.h>#include <stdio.h>#include <allegro5/allegro.h>#include <allegro5/allegro_primitives.h>#include "bullet_manager.h"#include "bullet.h" #include "sound_manager.h"#include "animator.h"#include "screen_config.h"#include <math.h>#define TOXIC_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/toxic_alien.png"#define RAGE_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/rage_alien.png"#define SPOOKY_ALIEN_SPRITE_PATH "../assets/images/sprites/alien/spooky_alien.png"#define ALIEN_BULLET_SPRITE_PATH "../assets/images/sprites/alien/alien_bullet.png"#define ALIEN_WIDTH 40#define ALIEN_HEIGHT 40#define ALIEN_SPEED 12  #define ALIEN_DES_STEP 40#define ALIEN_HORIZONTAL_GAP 20#define ALIEN_VERTICAL_GAP 30#define MAX_BULLETS 5#define FIRE_PROBABILITY .02f/// Configuração padrão para todas as balas dos aliens.const BulletConfig ALIEN_BULLET_CONFIG = {    .width = 5.0f,    .height = 18.0f,    .speed = 12.0f,    .move_dir = MOVE_DOWN,    .is_active = false,    .color = (RGB) {.red = 255, .green = 45, .blue = 0}, };/** * @brief Retorna uma estrura AlienConfig para cada tipo de alien.  *      * @param type O tipo de alien que se deseja obter a configuração. *  * @return Um AlienConfig conrrespondente ao tipo de alien recebido como argumento. */AlienConfig get_alien_config(AlienType type) {    AlienConfig basic_config = {        (Point) {.0f, .0f},        .width = ALIEN_WIDTH,        .height = ALIEN_HEIGHT,        .is_alive = false,        .speed = ALIEN_SPEED,        .descent_step = ALIEN_DES_STEP,        .draw_hitbox = false,    };    if (type == TOXIC_ALIEN) {        basic_config.points = 50;        basic_config.color = (RGB) {            .red = 127, .green = 255, .blue = 0};        basic_config.sprite_path = TOXIC_ALIEN_SPRITE_PATH;    }    if (type == RAGE_ALIEN) {        basic_config.points = 30;        basic_config.color = (RGB) {            .red = 255, .green = 45, .blue = 0};        basic_config.sprite_path = RAGE_ALIEN_SPRITE_PATH;    }    if (type == SPOOKY_ALIEN) {        basic_config.points = 10;        basic_config.color = (RGB) {            .red = 18, .green = 174, .blue = 9};        basic_config.sprite_path = SPOOKY_ALIEN_SPRITE_PATH;    }    return basic_config;}/** * @brief Calcula a largura total em pixels do grupo de aliens.  *      * @param columns Número de culunas da formação dos aliens. *  * @return O comprimento do grupo de aliens. */float calculate_aliens_group_width(int columns) {    return ALIEN_WIDTH * columns + (ALIEN_HORIZONTAL_GAP * (columns - 1));}/** * @brief Inicializa a estrutura AlienManager. *      * @param manager Ponteiro para o AlienManager. * @param rows Número de linhas da formação dos aliens. * @param columns Número de colunas da formação dos aliens. * @param move_interval Intervalo de tempo do movimento dos aliens. * @param fire_interval Intervalo de tempo do disparo dos aliens. */void init_alien_manager(AlienManager *manager, int rows, int columns, float move_interval,     float fire_interval) {    manager->bm = create_bullet_manager(MAX_BULLETS, ALIEN_BULLET_CONFIG,         get_sprite(ALIEN_BULLET_SPRITE_PATH));    manager->count = rows * columns;    manager->rows = rows;    manager->columns = columns;    manager->mov_dir = MOVE_RIGHT;    manager->move_interval = move_interval;    manager->last_move_time = 0;    manager->alives = 0;    manager->group_width = calculate_aliens_group_width(columns);    manager->fire_probability = FIRE_PROBABILITY;    manager->fire_interval = fire_interval;    manager->last_fire_time = 0;    manager->aliens = (Alien *) malloc(sizeof(Alien) * manager->count);        if (!manager->aliens) {        fprintf(stderr, "Falied to create aliens matrix.\n");        exit(-1);    }}/** * @brief Alloca memoria para a estrura AlienManager e retorna um poteiro para ela. *  * @return AlienManager. */AlienManager *create_alien_manager() {    AlienManager *manager = (AlienManager *) malloc(sizeof(AlienManager));    if (!manager) {        fprintf(stderr, "Failed to create Alien Manager.\n");        exit(-1);    }    return manager;}/** * @brief Retorna um Point que indica em qual posição da tela o grupo de aliens * posicionado.    *  * @param group_width Largura total da formação dos aliens. *  * @return Point representado em qual coordenada o grupo de aliens deve ser colocado. */Point get_alines_spawn_pos(int group_width) {    return (Point) {(SCREEN_WIDTH - group_width) / 2.0f, SCREEN_TOP_MARGIN};}/** * @brief Define o posicionamente de cada alien e troca seu estado logico para vivo .   *  * @param manager Ponteiro para o AlienManager. */void spawn_aliens(AlienManager *manager) {    Point start_pos = get_alines_spawn_pos(manager->group_width);    Point current_pos = start_pos;    for (int i = 0; i < manager->rows; i++) {        Alien *alien;        for (int j = 0; j < manager->columns; j++) {            alien = &manager->aliens[i * manager->columns + j];            manager->alives++;            alien->is_alive = true;            alien->pos = current_pos;            current_pos.x += alien->width + ALIEN_HORIZONTAL_GAP;        }        current_pos.y += alien->height + ALIEN_VERTICAL_GAP;        current_pos.x = start_pos.x;    }}/** * @brief Libera os recursos utilizados pelo AlienManager.   *  * @param manager Ponteiro para o AlienManager. */void destroy_alien_manager(AlienManager *manager) {    if (!manager) return;    for (int i = 0; i < manager->count; i++) {        Alien* alien = &manager->aliens[i];        destroy_alien(alien);    }    if (manager->aliens)         free(manager->aliens);        if (manager->bm)         destroy_bullet_manager(manager->bm);        free(manager);}/** * @breif Verifica um alien atingiu o canto direito da tela. *  * @param x Coordenada horizontal do alien. * @param width Largura do alien. * @param edge_max Coordenada do canto direito da tela.  *  * @return Bool indicando se canto direito da tela foi atingido. */bool has_hit_right_edge(int x, int width, int edge_max) {    return x + width > edge_max;}/** * @breif Verifica um alien atingiu o canto esquerdo da tela. *  * @param x Coordenada horizontal do alien. * @param edge_min Coordenada do canto esquerdo da tela.  *  * @return Bool indicando se canto esquerdo da tela foi atingido. */bool has_hit_left_edge(int x, int edge_min) {    return x < edge_min;}/** * @breif Verifica se algum alien atingiu os limites da tela. *  * @param manager Ponteiro para o AlienManager. * @param start_x Coordenada horizontal de início. * @param width Comprimento da tela. *  * @return Bool indicando se o grupo de aliens atingiu um dos cantos da tela. */bool alien_group_reached_edge(AlienManager *manager, int start_x, int width) {    for (int i = 0; i < manager->count; i++) {        Alien *alien = &manager->aliens[i];        if (!alien->is_alive) continue;        if (manager->mov_dir == MOVE_RIGHT &&             has_hit_right_edge(alien->pos.x, alien->width, width)) {            return true;        }        if (manager->mov_dir == MOVE_LEFT &&             has_hit_left_edge(alien->pos.x, start_x)) {            return true;        }    }    return false;}/** * @breif Move cada alien horizontalmente. *  * @param alien Ponteiro para o alien. * @param mov_dir Direção do movimento (MOVE_LEFT ou MOVE_RIGHT). * @param amount Quantidade pixels a mover. */void move_aliens_horizontal(AlienManager *manager, MoveDir dir, int amount) {     for (int i = 0; i < manager->count; i++) {            Alien *alien = &manager->aliens[i];            if (alien->is_alive)                move_alien_horizontal(alien, dir, amount);        }}/** * @breif Move cada alien verticalmente. *  * @param alien Ponteiro para o alien. * @param mov_dir Direção do movimento (MOVE_UP ou MOVE_DOWN). * @param amount Quantidade pixels a mover. */void move_aliens_vertical(AlienManager *manager, MoveDir dir, int amount) {    for (int i = 0; i < manager->count; i++) {        Alien *alien = &manager->aliens[i];        if (alien->is_alive)             move_alien_vertical(alien, dir, amount);    }            }/** *  * @breif Move o grupo de aliens horizontalmente até que eles colidam com os cantos da tela * então mevo-os verrticalmente e inverte sua direção de movimento horizontal. *  * @param manager Ponteiro para o AlienManager. */void handle_aliens_movement(AlienManager *manager) {    bool transpass_edge = alien_group_reached_edge(manager,             SCREEN_HORIZONTAL_MARGIN, SCREEN_WIDTH - SCREEN_HORIZONTAL_MARGIN);    if (transpass_edge) {        move_aliens_vertical(manager, MOVE_DOWN, ALIEN_DES_STEP);        manager->mov_dir = manager->mov_dir == MOVE_RIGHT ? MOVE_LEFT : MOVE_RIGHT;        return;    }    move_aliens_horizontal(manager, manager->mov_dir, ALIEN_SPEED);    }/** * @breif Retorna uma array the Rect contendo a posição dos aliens vivos.  *  * @param manager Ponteiro para o AlienManager. *  * @return React vector de retângulos representando os aliens ainda vivos. */Rect *get_alive_aliens_hitbox(AlienManager *manager) {    if (manager->alives == 0) return NULL;    Rect *hitboxes = (Rect *) malloc(sizeof(Rect) * manager->alives);    if (!hitboxes)         return NULL;        Rect *current = hitboxes;    for (int i = 0; i < manager->count; i++) {        Alien *alien = &manager->aliens[i];        if (alien->is_alive) {            *current = get_collider(alien->pos, alien->width, alien->height);            current++;        }    }    return hitboxes;}/** * @breif Libera a memória utilizada para armazenar a array de hitboxes. *  * @param hitboxes Ponteiro para a array de hitboxes. */void free_hitboxes_array(Rect *hitboxes) {    free(hitboxes);}/** * @breif Retorna uma posição de um alien vivo aleatório .  *  * @param manager Ponteiro para AlienManager. *  * @return React representando a hitbox de um alien. */Rect get_random_alien_hitbox(AlienManager *manager) {    int random_index = random_integer(0, manager->alives - 1);    Rect hitbox = {{-1, -1}, 0, 0};    Rect *hitboxes = get_alive_aliens_hitbox(manager);    if (!hitboxes)         return hitbox;    hitbox = hitboxes[random_index];    free_hitboxes_array(hitboxes);    return hitbox;}/** * @breif Dispara uma projétil a partir da posição de uma alien aleatório  * e toca o som de tiro. *  * @param manager Ponteiro para AlienManager. */void fire(AlienManager *manager) {    Rect hitbox = get_random_alien_hitbox(manager);    if (hitbox.pos.x < 0) return;    fire_bullet(manager->bm, hitbox);    play_sound(SFX_ALIEN_SHOOT);    manager->last_fire_time = al_get_time();}/** * @breif Verifica se o grupo de aliens pode atirar. *  * @param manager Ponteiro para AlienManager. * @param fire_chance Chance de um alien atirar. *  * @return Bool indicando se um projétil pode ser disparado.  */bool alien_can_fire(AlienManager *manager, float fire_chance) {    double now = al_get_time();    double delta_time = now - manager->last_fire_time;    return fire_chance <= manager->fire_probability &&            manager->bm->quantity < manager->bm->max &&           manager->alives > 0 &&           delta_time >= manager->fire_interval;}/** * @breif Verifica se o grupo de aliens pode atirar, se sim, dispara.  *  * @param manager Ponteiro para AlienManager. */void handle_fire(AlienManager *manager) {    float fire_chance = random_float();    if (alien_can_fire(manager, fire_chance))        fire(manager);}/** * @breif Faz o update do movimento dos aliens, incluido a animação dos aliens e  * dos projéties disparados.  *  * @param manager Ponteiro para AlienManager. */void update_aliens(AlienManager *manager) {    double now = al_get_time();    double delta_time = now - manager->last_move_time;    if (delta_time >= manager->move_interval) {        handle_aliens_movement(manager);        manager->last_move_time = now;    }    for (int i = 0; i < manager->count; i++) {        Alien *alien = &manager->aliens[i];        if (alien->is_alive)            update_animator(alien->animator);    }    update_bullets(manager->bm);    handle_fire(manager);}/** * @breif Verifica se todos os aliens foram mortos. *  * @param manager Ponteiro para AlienManager. *  * @return Bool representando se todos os aliens morreram. */bool all_aliens_dead(AlienManager *manager) {    for (int i = 0; i < manager->count; i++) {        if (manager->aliens[i].is_alive)             return false;    }    return true;}/** * @breif Troca o estado lógico do alien para morto, utiliza-se o id . * do alien para isso, nesse caso o id é a sua posição no vetor de aliens. *  * @param manager Ponteiro para AlienManager. * @param id Identificação do alien. */void kill_alien_by_id(AlienManager *manager, int id) {    kill_alien(&manager->aliens[id]);    manager->alives--;}/** * @breif Verifica se o grupo de aliens atingiu uma linha de perigo. *  * @param manager Ponteiro para AlienManager. * @param danger_line_y Coordenada vertical que se deseja verificar. *  * @return Bool definindo se os aliens passaram da danger line. */bool aliens_crossed_threshold(AlienManager *manager, float danger_line_y) {       for (int i = 0; i < manager->count; i++) {            Alien *alien = &manager->aliens[i];            if (!alien->is_alive) continue;            if (alien->pos.y + alien->height >= danger_line_y)                return true;       }    return false;}/** * @breif Desenha os aliens na tela somente se o alien estiver vivo. *  * @param manager Ponteiro para AlienManager. */void draw_aliens(AlienManager *manager) {    for (int i = 0; i < manager->count; i++) {        Alien *alien = &manager->aliens[i];        if (!alien->is_alive) continue;        draw_alien(alien);    }}
\ No newline at end of file
+#include "alien_manager.h"
+#include "alien.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include "bullet_manager.h"
+#include "bullet.h" 
+#include "sound_manager.h"
+#include "animator.h"
+#include "screen_config.h"
+#include "game_clock.h"
+#include "snapshot.h"
+#include "sprite_cache.h"
+#include "asset_paths.h"
+#include "session_arena.h"
+#include <string.h>
+#include <math.h>
+
+#define ALIEN_WIDTH 40
+#define ALIEN_HEIGHT 40
+#define ALIEN_SPEED 12  
+#define ALIEN_DES_STEP 40
+#define ALIEN_HORIZONTAL_GAP 20
+#define ALIEN_VERTICAL_GAP 30
+#define MAX_BULLETS 5
+#define FIRE_PROBABILITY .02f
+
+
+/// Configuração padrão para todas as balas dos aliens.
+
+const BulletConfig ALIEN_BULLET_CONFIG = {
+    .width = 5.0f,
+    .height = 18.0f,
+    .speed = 12.0f,
+    .move_dir = MOVE_DOWN,
+    .is_active = false,
+    .color = (RGB) {.red = 255, .green = 45, .blue = 0}, 
+};
+
+/**
+ * @brief Retorna uma estrura AlienConfig para cada tipo de alien. 
+ *     
+ * @param type O tipo de alien que se deseja obter a configuração.
+ * 
+ * @return Um AlienConfig conrrespondente ao tipo de alien recebido como argumento.
+ */
+AlienConfig get_alien_config(AlienType type) {
+    AlienConfig basic_config = {
+        (Point) {.0f, .0f},
+        .width = ALIEN_WIDTH,
+        .height = ALIEN_HEIGHT,
+        .is_alive = false,
+        .speed = ALIEN_SPEED,
+        .descent_step = ALIEN_DES_STEP,
+        .draw_hitbox = false,
+    };
+
+    if (type == TOXIC_ALIEN) {
+        basic_config.points = 50;
+        basic_config.color = (RGB) {
+            .red = 127, .green = 255, .blue = 0};
+        basic_config.sprite_path = TOXIC_ALIEN_SPRITE_PATH;
+
+    }
+
+    if (type == RAGE_ALIEN) {
+        basic_config.points = 30;
+        basic_config.color = (RGB) {
+            .red = 255, .green = 45, .blue = 0};
+        basic_config.sprite_path = RAGE_ALIEN_SPRITE_PATH;
+    }
+
+    if (type == SPOOKY_ALIEN) {
+        basic_config.points = 10;
+        basic_config.color = (RGB) {
+            .red = 18, .green = 174, .blue = 9};
+        basic_config.sprite_path = SPOOKY_ALIEN_SPRITE_PATH;
+    }
+
+    return basic_config;
+}
+
+/**
+ * @brief Calcula a largura total em pixels do grupo de aliens. 
+ *     
+ * @param columns Número de culunas da formação dos aliens.
+ * 
+ * @return O comprimento do grupo de aliens.
+ */
+float calculate_aliens_group_width(int columns) {
+    return ALIEN_WIDTH * columns + (ALIEN_HORIZONTAL_GAP * (columns - 1));
+}
+
+/**
+ * @brief Garante que o vetor de aliens comporta uma formação de count aliens. O vetor vem da arena 
+ * da sessão, então crescer copia os aliens para um vetor novo (o antigo só é descartado com a arena); 
+ * por isso a sessão reserva a maior formação uma única vez. Os slots novos começam sem animator, que 
+ * é alocado no primeiro init_alien do slot.
+ * 
+ * @param manager Ponteiro para o AlienManager.
+ * @param count Quantidade de aliens necessária.
+ */
+void reserve_aliens(AlienManager *manager, int count) {
+    if (count <= manager->capacity) return;
+
+    Alien *aliens = (Alien *) session_alloc(sizeof(Alien) * count);
+
+    if (manager->aliens)
+        memcpy(aliens, manager->aliens, sizeof(Alien) * manager->capacity);
+
+    for (int i = manager->capacity; i < count; i++)
+        aliens[i].animator = NULL;
+
+    manager->aliens = aliens;
+    manager->capacity = count;
+}
+
+/**
+ * @brief Inicializa a estrutura AlienManager. O pool de balas e o vetor de aliens são criados na 
+ * primeira chamada e reaproveitados nos estágios seguintes.
+ *     
+ * @param manager Ponteiro para o AlienManager.
+ * @param rows Número de linhas da formação dos aliens.
+ * @param columns Número de colunas da formação dos aliens.
+ * @param move_interval Intervalo de tempo do movimento dos aliens.
+ * @param fire_interval Intervalo de tempo do disparo dos aliens.
+ */
+void init_alien_manager(AlienManager *manager, int rows, int columns, float move_interval, 
+    float fire_interval) {
+    if (manager->bm)
+        reset_bullet_manager(manager->bm);
+    else
+        manager->bm = create_bullet_manager(MAX_BULLETS, ALIEN_BULLET_CONFIG, 
+            get_sprite(ALIEN_BULLET_SPRITE_PATH));
+
+    reserve_aliens(manager, rows * columns);
+    manager->count = rows * columns;
+    manager->rows = rows;
+    manager->columns = columns;
+    manager->mov_dir = MOVE_RIGHT;
+    manager->move_interval = move_interval;
+    manager->last_move_time = 0;
+    manager->alives = 0;
+    manager->group_width = calculate_aliens_group_width(columns);
+    manager->fire_probability = FIRE_PROBABILITY;
+    manager->fire_interval = fire_interval;
+    manager->last_fire_time = 0;
+}
+
+/**
+ * @brief Alloca a estrura AlienManager na arena da sessão e retorna um poteiro para ela.
+ * 
+ * @return AlienManager.
+ */
+AlienManager *create_alien_manager() {
+    AlienManager *manager = (AlienManager *) session_alloc(sizeof(AlienManager));
+
+    manager->aliens = NULL;
+    manager->bm = NULL;
+    manager->capacity = 0;
+
+    return manager;
+}
+
+/**
+ * @brief Retorna um Point que indica em qual posição da tela o grupo de aliens
+ * posicionado.   
+ * 
+ * @param group_width Largura total da formação dos aliens.
+ * 
+ * @return Point representado em qual coordenada o grupo de aliens deve ser colocado.
+ */
+Point get_alines_spawn_pos(int group_width) {
+    return (Point) {(SCREEN_WIDTH - group_width) / 2.0f, SCREEN_TOP_MARGIN};
+}
+
+/**
+ * @brief Define o posicionamente de cada alien e troca seu estado logico para vivo .  
+ * 
+ * @param manager Ponteiro para o AlienManager.
+ */
+void spawn_aliens(AlienManager *manager) {
+    Point start_pos = get_alines_spawn_pos(manager->group_width);
+    Point current_pos = start_pos;
+
+    for (int i = 0; i < manager->rows; i++) {
+        Alien *alien;
+        for (int j = 0; j < manager->columns; j++) {
+            alien = &manager->aliens[i * manager->columns + j];
+            manager->alives++;
+            alien->is_alive = true;
+            alien->pos = current_pos;
+            current_pos.x += alien->width + ALIEN_HORIZONTAL_GAP;
+        }
+
+        current_pos.y += alien->height + ALIEN_VERTICAL_GAP;
+        current_pos.x = start_pos.x;
+    }
+}
+
+/**
+ * @breif Verifica um alien atingiu o canto direito da tela.
+ * 
+ * @param x Coordenada horizontal do alien.
+ * @param width Largura do alien.
+ * @param edge_max Coordenada do canto direito da tela. 
+ * 
+ * @return Bool indicando se canto direito da tela foi atingido.
+ */
+bool has_hit_right_edge(int x, int width, int edge_max) {
+    return x + width > edge_max;
+}
+
+/**
+ * @breif Verifica um alien atingiu o canto esquerdo da tela.
+ * 
+ * @param x Coordenada horizontal do alien.
+ * @param edge_min Coordenada do canto esquerdo da tela. 
+ * 
+ * @return Bool indicando se canto esquerdo da tela foi atingido.
+ */
+bool has_hit_left_edge(int x, int edge_min) {
+    return x < edge_min;
+}
+
+/**
+ * @breif Verifica se algum alien atingiu os limites da tela.
+ * 
+ * @param manager Ponteiro para o AlienManager.
+ * @param start_x Coordenada horizontal de início.
+ * @param width Comprimento da tela.
+ * 
+ * @return Bool indicando se o grupo de aliens atingiu um dos cantos da tela.
+ */
+bool alien_group_reached_edge(AlienManager *manager, int start_x, int width) {
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+
+        if (!alien->is_alive) continue;
+
+        if (manager->mov_dir == MOVE_RIGHT && 
+            has_hit_right_edge(alien->pos.x, alien->width, width)) {
+            return true;
+        }
+
+        if (manager->mov_dir == MOVE_LEFT && 
+            has_hit_left_edge(alien->pos.x, start_x)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @breif Move cada alien horizontalmente.
+ * 
+ * @param alien Ponteiro para o alien.
+ * @param mov_dir Direção do movimento (MOVE_LEFT ou MOVE_RIGHT).
+ * @param amount Quantidade pixels a mover.
+ */
+void move_aliens_horizontal(AlienManager *manager, MoveDir dir, int amount) {
+     for (int i = 0; i < manager->count; i++) {
+            Alien *alien = &manager->aliens[i];
+
+            if (alien->is_alive)
+                move_alien_horizontal(alien, dir, amount);
+        }
+}
+
+/**
+ * @breif Move cada alien verticalmente.
+ * 
+ * @param alien Ponteiro para o alien.
+ * @param mov_dir Direção do movimento (MOVE_UP ou MOVE_DOWN).
+ * @param amount Quantidade pixels a mover.
+ */
+void move_aliens_vertical(AlienManager *manager, MoveDir dir, int amount) {
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+
+        if (alien->is_alive) 
+            move_alien_vertical(alien, dir, amount);
+    }
+            
+}
+
+/**
+ * 
+ * @breif Move o grupo de aliens horizontalmente até que eles colidam com os cantos da tela
+ * então mevo-os verrticalmente e inverte sua direção de movimento horizontal.
+ * 
+ * @param manager Ponteiro para o AlienManager.
+ */
+void handle_aliens_movement(AlienManager *manager) {
+    bool transpass_edge = alien_group_reached_edge(manager, 
+            SCREEN_HORIZONTAL_MARGIN, SCREEN_WIDTH - SCREEN_HORIZONTAL_MARGIN);
+
+    if (transpass_edge) {
+        move_aliens_vertical(manager, MOVE_DOWN, ALIEN_DES_STEP);
+        manager->mov_dir = manager->mov_dir == MOVE_RIGHT ? MOVE_LEFT : MOVE_RIGHT;
+        return;
+    }
+
+    move_aliens_horizontal(manager, manager->mov_dir, ALIEN_SPEED);    
+}
+
+/**
+ * @breif Retorna a hitbox do n-ésimo alien vivo, percorrendo a formação sem alocar memória.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param index Índice do alien entre os aliens vivos.
+ * 
+ * @return Rect representando a hitbox do alien, ou com posição negativa se não houver alien vivo nesse índice.
+ */
+Rect get_alive_alien_hitbox(AlienManager *manager, int index) {
+    Rect hitbox = {{-1, -1}, 0, 0};
+
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+
+        if (!alien->is_alive) continue;
+
+        if (index-- == 0)
+            return get_collider(alien->pos, alien->width, alien->height);
+    }
+
+    return hitbox;
+}
+
+/**
+ * @breif Retorna uma posição de um alien vivo aleatório . 
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * 
+ * @return React representando a hitbox de um alien.
+ */
+Rect get_random_alien_hitbox(AlienManager *manager) {
+    int random_index = random_integer(0, manager->alives - 1);
+
+    return get_alive_alien_hitbox(manager, random_index);
+}
+
+/**
+ * @breif Dispara uma projétil a partir da posição de uma alien aleatório 
+ * e toca o som de tiro.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ */
+void fire(AlienManager *manager) {
+    Rect hitbox = get_random_alien_hitbox(manager);
+
+    if (hitbox.pos.x < 0) return;
+
+    fire_bullet(manager->bm, hitbox);
+    play_sound(SFX_ALIEN_SHOOT);
+
+    manager->last_fire_time = get_game_time();
+}
+
+/**
+ * @breif Verifica se o grupo de aliens pode atirar.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param fire_chance Chance de um alien atirar.
+ * 
+ * @return Bool indicando se um projétil pode ser disparado. 
+ */
+bool alien_can_fire(AlienManager *manager, float fire_chance) {
+    double now = get_game_time();
+    double delta_time = now - manager->last_fire_time;
+
+    return fire_chance <= manager->fire_probability && 
+           manager->bm->quantity < manager->bm->max &&
+           manager->alives > 0 &&
+           delta_time >= manager->fire_interval;
+}
+
+/**
+ * @breif Verifica se o grupo de aliens pode atirar, se sim, dispara. 
+ * 
+ * @param manager Ponteiro para AlienManager.
+ */
+void handle_fire(AlienManager *manager) {
+    float fire_chance = random_float();
+
+    if (alien_can_fire(manager, fire_chance)) 
+       fire(manager);
+}
+
+/**
+ * @breif Faz o update do movimento dos aliens, incluido a animação dos aliens e 
+ * dos projéties disparados. 
+ * 
+ * @param manager Ponteiro para AlienManager.
+ */
+void update_aliens(AlienManager *manager) {
+    double now = get_game_time();
+    double delta_time = now - manager->last_move_time;
+
+    if (delta_time >= manager->move_interval) {
+        handle_aliens_movement(manager);
+        manager->last_move_time = now;
+    }
+
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+
+        if (alien->is_alive)
+            update_animator(alien->animator);
+    }
+
+    update_bullets(manager->bm);
+    handle_fire(manager);
+}
+
+/**
+ * @breif Verifica se todos os aliens foram mortos.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * 
+ * @return Bool representando se todos os aliens morreram.
+ */
+bool all_aliens_dead(AlienManager *manager) {
+    for (int i = 0; i < manager->count; i++) {
+        if (manager->aliens[i].is_alive) 
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @breif Troca o estado lógico do alien para morto, utiliza-se o id .
+ * do alien para isso, nesse caso o id é a sua posição no vetor de aliens.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param id Identificação do alien.
+ */
+void kill_alien_by_id(AlienManager *manager, int id) {
+    kill_alien(&manager->aliens[id]);
+    manager->alives--;
+}
+
+/**
+ * @breif Verifica se o grupo de aliens atingiu uma linha de perigo.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param danger_line_y Coordenada vertical que se deseja verificar.
+ * 
+ * @return Bool definindo se os aliens passaram da danger line.
+ */
+bool aliens_crossed_threshold(AlienManager *manager, float danger_line_y) {
+       for (int i = 0; i < manager->count; i++) {
+            Alien *alien = &manager->aliens[i];
+
+            if (!alien->is_alive) continue;
+
+            if (alien->pos.y + alien->height >= danger_line_y)
+                return true;
+       }
+
+    return false;
+}
+
+/**
+ * @breif Desenha os aliens na tela somente se o alien estiver vivo.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ */
+void draw_aliens(AlienManager *manager) {
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+
+        if (!alien->is_alive) continue;
+
+        draw_alien(alien);
+    }
+}
+
+/**
+ * @brief Copia o estado mutável da formação de aliens e de suas balas para um AlienFormationState.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param state Ponteiro para o AlienFormationState que receberá o estado.
+ * 
+ * @return Bool indicando se o estado coube no AlienFormationState.
+ */
+bool save_alien_formation_state(AlienManager *manager, AlienFormationState *state) {
+    if (manager->count > SNAPSHOT_MAX_ALIENS) return false;
+
+    state->count = manager->count;
+    state->alives = manager->alives;
+    state->mov_dir = manager->mov_dir;
+    state->last_move_time = manager->last_move_time;
+    state->last_fire_time = manager->last_fire_time;
+
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+        AlienState *alien_state = &state->aliens[i];
+
+        alien_state->pos = alien->pos;
+        alien_state->is_alive = alien->is_alive;
+        save_animator_state(alien->animator, &alien_state->animator);
+    }
+
+    return save_bullets_state(manager->bm, &state->bullets);
+}
+
+/**
+ * @brief Restaura o estado mutável da formação de aliens, o AlienFormationState deve ter sido 
+ * salvo de uma formação com a mesma quantidade de aliens.
+ * 
+ * @param manager Ponteiro para AlienManager.
+ * @param state Ponteiro para o AlienFormationState salvo.
+ */
+void restore_alien_formation_state(AlienManager *manager, const AlienFormationState *state) {
+    manager->alives = state->alives;
+    manager->mov_dir = state->mov_dir;
+    manager->last_move_time = state->last_move_time;
+    manager->last_fire_time = state->last_fire_time;
+
+    for (int i = 0; i < manager->count; i++) {
+        Alien *alien = &manager->aliens[i];
+        const AlienState *alien_state = &state->aliens[i];
+
+        alien->pos = alien_state->pos;
+        alien->is_alive = alien_state->is_alive;
+        restore_animator_state(alien->animator, &alien_state->animator);
+    }
+
+    restore_bullets_state(manager->bm, &state->bullets);
+}
@@ -7,12 +7,16 @@
 #include "sound_manager.h"
 #include "stage_manager.h"
 #include "game_context.h"
+#include "game_clock.h"
+#include "snapshot.h"
+#include "sprite_cache.h"
+#include "session_arena.h"
+#include "asset_paths.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
 #include <math.h>
 
-#define UFO_SPRITE_PATH "../assets/images/sprites/alien/ufo.png" 
 #define UFO_SPEED 2
 #define UFO_WIDTH 60
 #define UFO_HEIGHT 40
@@ -40,35 +44,28 @@ void init_ufo(UFO *ufo) {
     ufo->sprite_sheet = get_sprite(UFO_SPRITE_PATH); 
     ufo->draw_hitbox = false;
     ufo->color = al_map_rgb(255, 255, 255);
-    ufo->last_spawn = al_get_time();
+    ufo->last_spawn = get_game_time();
     ufo->is_active = false;
+    ufo->mov_dir = NO_MOVE;
+    ufo->points = 0;
+    ufo->pos = (Point) {0, 0};
 
-    Animator *animator = (Animator *) malloc(sizeof(Animator));
+    if (!ufo->animator)
+        ufo->animator = (Animator *) session_alloc(sizeof(Animator));
 
-    if (!animator) {
-        fprintf(stderr, "Failed to create animator.\n");
-        exit(-1);
-    }
-
-    init_animator(animator, UFO_ANIMATION_FRAMES, 
+    init_animator(ufo->animator, UFO_ANIMATION_FRAMES, 
         UFO_WIDTH, UFO_HEIGHT, 1.0f / UFO_ANIMATION_FRAMES, true);
-
-    ufo->animator = animator;
 }
 
 /**
- * @brief Aloca memária para a estrutura UFO e retorna um ponteiro para a estrutura criada.
+ * @brief Aloca a estrutura UFO na arena da sessão e retorna um ponteiro para a estrutura criada.
  * 
  * @return UFO.
  */
 UFO * create_ufo() {
-    UFO *ufo = (UFO *) malloc(sizeof(UFO));
-
-    if (!ufo) {
-        fprintf(stderr, "Failed to create UFO.\n");
-        exit(-1);
-    }
+    UFO *ufo = (UFO *) session_alloc(sizeof(UFO));
 
+    ufo->animator = NULL;
     init_ufo(ufo);
 
     return ufo;
@@ -120,7 +117,7 @@ void set_ufo_points(UFO *ufo) {
 void active_ufo(UFO *ufo) {
     ufo->is_active = true;
     ufo->speed = UFO_SPEED;
-    ufo->last_spawn = al_get_time();
+    ufo->last_spawn = get_game_time();
     spawn_ufo(ufo);
     set_ufo_points(ufo);
     play_sound(SFX_UFO);
@@ -144,7 +141,7 @@ void kill_ufo(UFO *ufo) {
  */
 void deactive_ufo(UFO *ufo) {
     ufo->is_active = false;
-    ufo->last_spawn = al_get_time();
+    ufo->last_spawn = get_game_time();
     remove_sound(SFX_UFO);
     rewind_sound(SFX_UFO);
 }
@@ -209,7 +206,7 @@ bool is_ufo_alive(UFO *ufo) {
  * @param ufo Ponteiro para UFO.
  */
 void update_ufo(UFO *ufo) {
-    double now = al_get_time();
+    double now = get_game_time();
     double delta_time = now - ufo->last_spawn;
 
     if (is_ufo_alive(ufo)) {
@@ -242,14 +239,33 @@ void draw_ufo(UFO *ufo) {
 
 
 /**
- * @brief Libera os recursos utilizados pelo UFO.
+ * @brief Copia o estado mutável do UFO para um UFOState.
  * 
  * @param ufo Ponteiro para UFO.
+ * @param state Ponteiro para o UFOState que receberá o estado.
  */
-void destroy_ufo(UFO *ufo) {
-    if (!ufo) return;
-    deactive_ufo(ufo);
-    if (ufo->animator) destroy_animator(ufo->animator);
-    if (ufo->sprite_sheet) al_destroy_bitmap(ufo->sprite_sheet);
-    free(ufo);
-}
\ No newline at end of file
+void save_ufo_state(UFO *ufo, UFOState *state) {
+    state->pos = ufo->pos;
+    state->speed = ufo->speed;
+    state->mov_dir = ufo->mov_dir;
+    state->is_active = ufo->is_active;
+    state->points = ufo->points;
+    state->last_spawn = ufo->last_spawn;
+    save_animator_state(ufo->animator, &state->animator);
+}
+
+/**
+ * @brief Restaura o estado mutável do UFO a partir de um UFOState.
+ * 
+ * @param ufo Ponteiro para UFO.
+ * @param state Ponteiro para o UFOState salvo.
+ */
+void restore_ufo_state(UFO *ufo, const UFOState *state) {
+    ufo->pos = state->pos;
+    ufo->speed = state->speed;
+    ufo->mov_dir = state->mov_dir;
+    ufo->is_active = state->is_active;
+    ufo->points = state->points;
+    ufo->last_spawn = state->last_spawn;
+    restore_animator_state(ufo->animator, &state->animator);
+}
@@ -1,4 +1,7 @@
 #include "animator.h"
+#include "game_clock.h"
+#include "snapshot.h"
+#include "bitmap_audit.h"
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_image.h>
 #include <stdlib.h>
@@ -29,7 +32,7 @@ void init_animator(Animator *animator, int count, int width, int height, double
  * @param animator Ponteiro para o Animator a ser atualizado.
  */
 void update_animator(Animator *animator) {
-    double now = al_get_time();
+    double now = get_game_time();
     double delta_time = now - animator->last_update;
 
     if (delta_time >= animator->frame_duration) {
@@ -52,6 +55,7 @@ void update_animator(Animator *animator) {
  * @param y Posição vertical.
  */
 void draw_animated_sprite(ALLEGRO_BITMAP *sprite_sheet, Animator *animator, float x, float y) {
+    audit_bitmap(sprite_sheet, "draw_animated_sprite");
     al_draw_bitmap_region(
         sprite_sheet, 
         animator->current_frame * animator->frame_width,
@@ -62,19 +66,32 @@ void draw_animated_sprite(ALLEGRO_BITMAP *sprite_sheet, Animator *animator, floa
 }
 
 /**
- * @brief Libera a memória alocada para o Animator.
+ * @brief Reinicia a animação para o primeiro quadro.
  * 
- * @param animator Ponteiro para o Animator a ser destruído.
+ * @param animator Ponteiro para o Animator.
  */
-void destroy_animator(Animator * animator) {
-    free(animator);
+void reset_animation(Animator *animator) {
+    animator->current_frame = 0;
 }
 
 /**
- * @brief Reinicia a animação para o primeiro quadro.
+ * @brief Copia o estado mutável do Animator para um AnimatorState.
  * 
  * @param animator Ponteiro para o Animator.
+ * @param state Ponteiro para o AnimatorState que receberá o estado.
  */
-void reset_animation(Animator *animator) {
-    animator->current_frame = 0;
+void save_animator_state(Animator *animator, AnimatorState *state) {
+    state->current_frame = animator->current_frame;
+    state->last_update = animator->last_update;
+}
+
+/**
+ * @brief Restaura o estado mutável do Animator a partir de um AnimatorState.
+ * 
+ * @param animator Ponteiro para o Animator.
+ * @param state Ponteiro para o AnimatorState salvo.
+ */
+void restore_animator_state(Animator *animator, const AnimatorState *state) {
+    animator->current_frame = state->current_frame;
+    animator->last_update = state->last_update;
 }
\ No newline at end of file
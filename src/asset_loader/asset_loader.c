@@ -0,0 +1,136 @@
+#include "asset_loader.h"
+#include "sprite_cache.h"
+#include <allegro5/allegro.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static AssetLoadJob job = {
+    .count = 0,
+    .loaded = 0,
+    .thread = NULL,
+    .mutex = NULL,
+};
+
+/**
+ * @brief Retorna quantos assets do job já foram carregados.
+ * 
+ * @return Quantidade de assets carregados.
+ */
+int get_loaded_assets() {
+    al_lock_mutex(job.mutex);
+    int loaded = job.loaded;
+    al_unlock_mutex(job.mutex);
+
+    return loaded;
+}
+
+/**
+ * @brief Função do worker thread, carrega as imagens do job como bitmaps de memória.
+ * 
+ * @param thread O ALLEGRO_THREAD do worker.
+ * @param arg Não utilizado.
+ * 
+ * @return NULL.
+ */
+void *asset_loader_thread(ALLEGRO_THREAD *thread, void *arg) {
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+    for (int i = 0; i < job.count && !al_get_thread_should_stop(thread); i++) {
+        job.bitmaps[i] = al_load_bitmap(job.paths[i]);
+
+        al_lock_mutex(job.mutex);
+        job.loaded++;
+        al_unlock_mutex(job.mutex);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Inicia o carregamento em background dos sprites que ainda não estão no sprite cache. Se 
+ * um job anterior ainda estiver rodando, ele é finalizado antes.
+ * 
+ * @param paths Caminhos das imagens.
+ * @param count Quantidade de caminhos.
+ */
+void start_asset_loading(const char **paths, int count) {
+    wait_asset_loading();
+
+    job.count = 0;
+    job.loaded = 0;
+
+    for (int i = 0; i < count && job.count < ASSET_LOADER_MAX_JOB; i++) {
+        if (is_sprite_cached(paths[i])) continue;
+
+        job.paths[job.count] = paths[i];
+        job.bitmaps[job.count] = NULL;
+        job.count++;
+    }
+
+    if (job.count == 0) return;
+
+    if (!job.mutex) job.mutex = al_create_mutex();
+    job.thread = al_create_thread(asset_loader_thread, NULL);
+
+    if (!job.mutex || !job.thread) {
+        fprintf(stderr, "Failed to create asset loader thread.\n");
+        exit(-1);
+    }
+
+    al_start_thread(job.thread);
+}
+
+/**
+ * @brief Retorna o progresso do job atual.
+ * 
+ * @return Progresso entre 0 e 1, 1 quando não há job.
+ */
+float get_asset_loading_progress() {
+    if (!job.thread) return 1;
+
+    return (float) get_loaded_assets() / job.count;
+}
+
+/**
+ * @brief Junta o worker e entrega os bitmaps carregados ao sprite cache, convertidos para bitmaps 
+ * de vídeo na thread principal. Imagens que falharam não são adicionadas, assim get_sprite tenta 
+ * carregá-las de novo e reporta o erro.
+ */
+void adopt_loaded_assets() {
+    al_join_thread(job.thread, NULL);
+    al_destroy_thread(job.thread);
+    job.thread = NULL;
+
+    for (int i = 0; i < job.count; i++) {
+        if (!job.bitmaps[i]) continue;
+
+        al_convert_bitmap(job.bitmaps[i]);
+        add_sprite(job.paths[i], job.bitmaps[i]);
+        job.bitmaps[i] = NULL;
+    }
+}
+
+/**
+ * @brief Verifica se o job atual terminou e, nesse caso, entrega os sprites ao cache. Não bloqueia.
+ * 
+ * @return Bool indicando se não há mais assets sendo carregados.
+ */
+bool finish_asset_loading() {
+    if (!job.thread) return true;
+
+    if (get_loaded_assets() < job.count) return false;
+
+    adopt_loaded_assets();
+
+    return true;
+}
+
+/**
+ * @brief Espera o job atual terminar e entrega os sprites ao cache, deve ser chamada antes de 
+ * destruir o sprite cache.
+ */
+void wait_asset_loading() {
+    if (!job.thread) return;
+
+    adopt_loaded_assets();
+}
@@ -0,0 +1,110 @@
+#include "autopilot.h"
+#include "state_manager.h"
+#include <string.h>
+
+/**
+ * @brief Estrutura que guarda o estado do autopilot, as teclas que estão pressionadas e 
+ * há quantos ticks o estado atual está ativo.
+ */
+typedef struct Autopilot {
+    GameState state;
+    long state_ticks;
+    bool left_down;
+    bool right_down;
+    bool shoot_down;
+} Autopilot;
+
+static Autopilot ap = {.state = STATE_EXIT};
+
+/**
+ * @brief Descarta as teclas pressionadas e reinicia a contagem de ticks.
+ */
+void reset_autopilot() {
+    GameState state = ap.state;
+
+    memset(&ap, 0, sizeof(Autopilot));
+    ap.state = state;
+}
+
+/**
+ * @brief Gera um evento de teclado sintético e o entrega ao handler.
+ * 
+ * @param handler Função que receberá o evento.
+ * @param type ALLEGRO_EVENT_KEY_DOWN ou ALLEGRO_EVENT_KEY_UP.
+ * @param key_code Código da tecla.
+ */
+void emit_key(AutopilotEventHandler handler, ALLEGRO_EVENT_TYPE type, int key_code) {
+    ALLEGRO_EVENT event;
+
+    memset(&event, 0, sizeof(ALLEGRO_EVENT));
+    event.type = type;
+    event.keyboard.keycode = key_code;
+
+    handler(event);
+}
+
+/**
+ * @brief Pressiona ou solta uma tecla caso seu estado seja diferente do desejado.
+ * 
+ * @param handler Função que receberá o evento.
+ * @param is_down Ponteiro para o estado atual da tecla.
+ * @param down Estado desejado.
+ * @param key_code Código da tecla.
+ */
+void set_key(AutopilotEventHandler handler, bool *is_down, bool down, int key_code) {
+    if (*is_down == down) return;
+
+    *is_down = down;
+    emit_key(handler, down ? ALLEGRO_EVENT_KEY_DOWN : ALLEGRO_EVENT_KEY_UP, key_code);
+}
+
+/**
+ * @brief Controla o player: atira sem parar e varre a tela da esquerda para a direita, trocando 
+ * de direção a cada AUTOPILOT_SWEEP_TICKS. Não usa o gerador pseudo-aleatório do game, então 
+ * não altera a simulação.
+ * 
+ * @param handler Função que receberá os eventos.
+ */
+void drive_player(AutopilotEventHandler handler) {
+    bool move_right = (ap.state_ticks / AUTOPILOT_SWEEP_TICKS) % 2 == 0;
+
+    set_key(handler, &ap.shoot_down, true, ALLEGRO_KEY_SPACE);
+    set_key(handler, &ap.left_down, !move_right, ALLEGRO_KEY_LEFT);
+    set_key(handler, &ap.right_down, move_right, ALLEGRO_KEY_RIGHT);
+}
+
+/**
+ * @brief Gera os eventos de teclado de um tick, navegando pelos menus e jogando as partidas
+ * sem intervenção do usuário.
+ * 
+ * @param handler Função que receberá os eventos.
+ */
+void run_autopilot(AutopilotEventHandler handler) {
+    GameState state = get_game_state();
+
+    if (state != ap.state) {
+        ap.state = state;
+        reset_autopilot();
+    }
+
+    switch (state) {
+        case STATE_MENU:
+        case STATE_GAME_OVER:
+            emit_key(handler, ALLEGRO_EVENT_KEY_DOWN, ALLEGRO_KEY_ENTER);
+            break;
+        case STATE_SAVE_SCORE:
+            emit_key(handler, ALLEGRO_EVENT_KEY_DOWN, 
+                ap.state_ticks % 2 == 0 ? ALLEGRO_KEY_A : ALLEGRO_KEY_ENTER);
+            break;
+        case STATE_PLAYING:
+            drive_player(handler);
+            break;
+        case STATE_SCORE_RANK:
+            emit_key(handler, ALLEGRO_EVENT_KEY_DOWN, ALLEGRO_KEY_ESCAPE);
+            break;
+        default:
+            break;
+    }
+
+    ap.state_ticks++;
+}
@@ -0,0 +1,49 @@
+#include "bitmap_audit.h"
+#include <allegro5/allegro.h>
+#include <stdio.h>
+
+static BitmapAudit audit = {
+    .enabled = false,
+    .frame = 0,
+    .memory_draws = 0,
+    .first_label = NULL,
+};
+
+/**
+ * @brief Ativa a auditoria de bitmaps.
+ */
+void enable_bitmap_audit() {
+    audit.enabled = true;
+}
+
+/**
+ * @brief Registra um bitmap desenhado no frame atual, se ele for um bitmap em memória o desenho 
+ * é contado para o relatório do frame.
+ * 
+ * @param bitmap Bitmap que será desenhado.
+ * @param label Nome de quem desenha o bitmap, usado no relatório.
+ */
+void audit_bitmap(ALLEGRO_BITMAP *bitmap, const char *label) {
+    if (!audit.enabled || !bitmap) return;
+
+    if (!(al_get_bitmap_flags(bitmap) & ALLEGRO_MEMORY_BITMAP)) return;
+
+    if (audit.memory_draws == 0) audit.first_label = label;
+    audit.memory_draws++;
+}
+
+/**
+ * @brief Finaliza o frame atual, printando no terminal quantos bitmaps em memória foram desenhados nele.
+ */
+void end_bitmap_audit_frame() {
+    if (!audit.enabled) return;
+
+    if (audit.memory_draws > 0) {
+        fprintf(stderr, "Frame %ld drew %d memory bitmap(s), first in %s.\n",
+            audit.frame, audit.memory_draws, audit.first_label);
+    }
+
+    audit.frame++;
+    audit.memory_draws = 0;
+    audit.first_label = NULL;
+}
@@ -1,5 +1,6 @@
 #include "bullet.h"
 #include "collision.h"
+#include "bitmap_audit.h"
 #include <allegro5/allegro_image.h>
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro.h>
@@ -59,6 +60,7 @@ void move_bullet(Bullet * bullet) {
  * @param bullet Ponteiro para a bala.
  */
 void draw_bullet(Bullet * bullet) {
+    audit_bitmap(bullet->sprite, "draw_bullet");
     al_draw_bitmap(bullet->sprite, bullet->pos.x, bullet->pos.y, 0);
 
     if (bullet->draw_hitbox)
@@ -68,15 +70,6 @@ void draw_bullet(Bullet * bullet) {
                          bullet->color, 0);
 }
 
-/**
- * @brief Libera os recursos utilizados pela Bullet.
- * 
- * @param bullet Ponteiro para a bala.
- */
-void destroy_bullet(Bullet * bullet) {
-    al_destroy_bitmap(bullet->sprite);
-}
-
 /**
  * @brief Ativa a bala para que ela possa ser atualizada/desenhada.
  * 
@@ -3,9 +3,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "screen_config.h"
+#include "snapshot.h"
+#include "session_arena.h"
 
 /**
- * @brief Cria e inicializa um gerenciador de balas com balas pré-criadas e inativas.
+ * @brief Cria e inicializa um gerenciador de balas com balas pré-criadas e inativas, alocados na 
+ * arena da sessão.
  * 
  * @param max Número máximo.
  * @param cfg Configuração padrão de cada bala.
@@ -14,20 +17,8 @@
  * @return BulletManager.
  */
 BulletManager* create_bullet_manager(int max, BulletConfig cfg, ALLEGRO_BITMAP *sprite) {
-    BulletManager *manager = (BulletManager *) malloc(sizeof(BulletManager));
-
-    if (!manager) {
-        fprintf(stderr, "Failed to create bullet manager.\n");
-        exit(-1);
-    }
-
-    manager->bullets = (Bullet *) malloc(sizeof(Bullet) * max);
-
-    if (!manager->bullets) {
-        fprintf(stderr, "Falied to create bullets array.\n");
-        exit(-1);
-    } 
-
+    BulletManager *manager = (BulletManager *) session_alloc(sizeof(BulletManager));
+    manager->bullets = (Bullet *) session_alloc(sizeof(Bullet) * max);
     manager->max = max;
     manager->quantity = 0;
 
@@ -42,6 +33,24 @@ BulletManager* create_bullet_manager(int max, BulletConfig cfg, ALLEGRO_BITMAP *
      return manager;
 }
 
+/**
+ * @brief Desativa todas as balas e as devolve para a posição inicial, deixando o pool como 
+ * recém-criado sem alocar nada.
+ * 
+ * @param manager Ponteiro para o gerenciador de balas.
+ */
+void reset_bullet_manager(BulletManager *manager) {
+    Rect spawner = get_collider((Point) {-10.f, -10.f}, 0, 0);
+
+    for (int i = 0; i < manager->max; i++) {
+        Bullet *bullet = &manager->bullets[i];
+        deactive_bullet(bullet);
+        bullet->pos = get_bullet_spawn_pos(spawner, bullet->width, bullet->height);
+    }
+
+    manager->quantity = 0;
+}
+
 /**
  * @brief Verifica se a bala está fora da tela.
  * 
@@ -72,26 +81,6 @@ void update_bullets(BulletManager * manager) {
     }
 }
 
-/**
- * @brief Libera os recursos usados pelas balas e o gerenciador.
- * 
- * @param manager Ponteiro para o gerenciador.
- */
-void destroy_bullet_manager(BulletManager * manager) {
-    if (!manager) return;
-
-    for (int i = 0; i < manager->quantity; i++) {
-        Bullet *bullet = &manager->bullets[i];
-        destroy_bullet(bullet);
-    }
-
-    if (manager->bullets) 
-        free(manager->bullets);
-    
-
-    free(manager);
-}
-
 /**
  * @brief Retorna um ponteiro para a próxima bala inativa disponível.
  * 
@@ -156,3 +145,41 @@ void draw_bullets(BulletManager *manager) {
         draw_bullet(bullet);
     }
 }
+
+/**
+ * @brief Copia o estado mutável das balas para um BulletPoolState.
+ * 
+ * @param manager Ponteiro para o gerenciador de balas.
+ * @param state Ponteiro para o BulletPoolState que receberá o estado.
+ * 
+ * @return Bool indicando se o estado coube no BulletPoolState.
+ */
+bool save_bullets_state(BulletManager *manager, BulletPoolState *state) {
+    if (manager->max > SNAPSHOT_MAX_BULLETS) return false;
+
+    state->max = manager->max;
+    state->quantity = manager->quantity;
+
+    for (int i = 0; i < manager->max; i++) {
+        state->bullets[i].pos = manager->bullets[i].pos;
+        state->bullets[i].is_active = manager->bullets[i].is_active;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Restaura o estado mutável das balas, o BulletPoolState deve ter sido salvo
+ * de um gerenciador com a mesma quantidade máxima de balas.
+ * 
+ * @param manager Ponteiro para o gerenciador de balas.
+ * @param state Ponteiro para o BulletPoolState salvo.
+ */
+void restore_bullets_state(BulletManager *manager, const BulletPoolState *state) {
+    manager->quantity = state->quantity;
+
+    for (int i = 0; i < manager->max; i++) {
+        manager->bullets[i].pos = state->bullets[i].pos;
+        manager->bullets[i].is_active = state->bullets[i].is_active;
+    }
+}
@@ -12,6 +12,15 @@
 #include "game_context.h"
 #include "game_stuff.h"
 #include "allegro_stuff.h"
+#include "game_clock.h"
+#include "game_options.h"
+#include "replay.h"
+#include "autopilot.h"
+#include "perf_log.h"
+#include "bitmap_audit.h"
+#include "screen_cache.h"
+#include "sprite_cache.h"
+#include "asset_loader.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -43,11 +52,26 @@ void handle_input(ALLEGRO_EVENT event) {
 }
 
 /**
- * @brief Faz o update do estdo ativo.
+ * @brief Escreve as estatísticas de áudio no log de performance a cada PERF_LOG_INTERVAL segundos.
+ */
+void update_perf_log() {
+    static double last_write = 0;
+
+    if (!is_perf_log_open() || al_get_time() - last_write < PERF_LOG_INTERVAL) return;
+
+    last_write = al_get_time();
+    write_audio_stats_to_perf_log();
+}
+
+/**
+ * @brief Avança o relógio da simulação e os fades das músicas em um tick e faz o update do estdo ativo.
  * 
  * @return Bool indicando se o programa deve continuar rodando ou não.
  */
 bool update() {
+    advance_game_clock(FPS);
+    update_music_fades(FPS);
+
     switch(get_game_state()) {
         case STATE_MENU:
             update_menu();
@@ -67,6 +91,9 @@ bool update() {
             break;
     }
 
+    flush_sound_requests();
+    update_perf_log();
+
     return true;
 }
 
@@ -96,6 +123,131 @@ void draw() {
         default:
             break;
     }
+
+    end_bitmap_audit_frame();
+}
+
+/**
+ * @brief Verifica se o evento deve ser repassado para o estado ativo.
+ * 
+ * @param event O evento disparado.
+ * 
+ * @return Bool indicando se o evento é de teclado ou de fechamento da janela.
+ */
+bool is_input_event(ALLEGRO_EVENT event) {
+    return event.type == ALLEGRO_EVENT_KEY_UP || 
+        event.type == ALLEGRO_EVENT_KEY_DOWN ||
+        event.type == ALLEGRO_EVENT_DISPLAY_CLOSE;
+}
+
+/**
+ * @brief Verifica se o evento exige que a tela seja desenhada de novo, mesmo sem ticks.
+ * 
+ * @param event O evento disparado.
+ * 
+ * @return Bool indicando se a janela foi exposta ou voltou a ter foco.
+ */
+bool is_redraw_event(ALLEGRO_EVENT event) {
+    return event.type == ALLEGRO_EVENT_DISPLAY_EXPOSE || 
+        event.type == ALLEGRO_EVENT_DISPLAY_SWITCH_IN;
+}
+
+/**
+ * @brief Verifica se o loop pode parar o timer: no modo low power, os estados sem lógica por tick 
+ * (menu, game over, save score e score rank) só precisam de ticks enquanto algum fade de música 
+ * estiver em andamento. O autopilot gera seus inputs nos ticks, então nunca fica ocioso.
+ * 
+ * @return Bool indicando se o timer pode ser parado.
+ */
+bool can_idle() {
+    if (!get_game_options()->low_power || get_game_options()->autopilot) return false;
+
+    switch(get_game_state()) {
+        case STATE_MENU:
+        case STATE_GAME_OVER:
+        case STATE_SAVE_SCORE:
+        case STATE_SCORE_RANK:
+            return !has_pending_music_fades();
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Executa um tick da simulação, gerando antes os inputs do autopilot caso ele esteja ativo.
+ * 
+ * @return Bool indicando se o programa deve continuar rodando ou não.
+ */
+bool run_tick() {
+    if (get_game_options()->autopilot)
+        run_autopilot(handle_input);
+
+    return update();
+}
+
+/**
+ * @brief Loop do modo turbo, ignora o timer e executa os ticks um após o outro, desenhando 
+ * somente a cada N ticks. Os eventos pendentes são processados antes de cada tick.
+ * 
+ * @param queue Fila de eventos do programa.
+ */
+void run_turbo_loop(ALLEGRO_EVENT_QUEUE *queue) {
+    ALLEGRO_EVENT event;
+    int render_interval = get_game_options()->turbo_render_interval;
+    long ticks = 0;
+    bool is_running = true;
+
+    while (is_running) {
+        while (al_get_next_event(queue, &event)) {
+            if (is_input_event(event))
+                handle_input(event);
+        }
+
+        is_running = run_tick();
+        ticks++;
+
+        if (is_running && render_interval > 0 && ticks % render_interval == 0)
+            draw();
+    }
+}
+
+/**
+ * @brief Loop padrão, executa um tick a cada evento do timer e desenha quando a fila de 
+ * eventos estiver vazia. No modo low power o timer é parado nas telas estáticas depois do 
+ * desenho e o loop fica bloqueado esperando eventos; um input ou a janela exposta voltam 
+ * a ligar o timer, que fica ligado até a tela estar ociosa de novo.
+ * 
+ * @param queue Fila de eventos do programa.
+ */
+void run_timed_loop(ALLEGRO_EVENT_QUEUE *queue, ALLEGRO_TIMER *timer) {
+    ALLEGRO_EVENT event;
+    bool redraw = false;
+    bool is_running = true;
+
+    al_start_timer(timer);
+
+    while (is_running) {
+         al_wait_for_event(queue, &event);
+
+        if (is_input_event(event)) 
+            handle_input(event);
+
+        if ((is_input_event(event) || is_redraw_event(event)) && !al_get_timer_started(timer))
+            al_start_timer(timer);
+                  
+        if (event.type == ALLEGRO_EVENT_TIMER) {
+            is_running = run_tick();
+            redraw = true;
+        }
+
+        if (redraw && al_is_event_queue_empty(queue)) {
+            draw();
+            redraw = false;
+
+            if (can_idle())
+                al_stop_timer(timer);
+        }
+    }
 }
 
 //TODO 
@@ -106,22 +258,52 @@ void draw() {
 /**
  * @brief Ponto de início para o game, onde será carregado todas as dependências
  * do game e os componentes necessários para rodar o game.
+ * 
+ * @param argc Quantidade de argumentos da linha de comando.
+ * @param argv Argumentos da linha de comando (ex: --practice).
  * */
-int main() {
+int main(int argc, char **argv) {
     ALLEGRO_DISPLAY *display = NULL;
     ALLEGRO_EVENT_QUEUE *queue = NULL;
     ALLEGRO_TIMER *timer = NULL;
-    ALLEGRO_EVENT event;
-    bool redraw = false;
-    bool is_running = true;
+
+    if (!parse_game_options(argc, argv))
+        return -1;
     
+    if (get_game_options()->no_audio || get_game_options()->verify_replay_path)
+        use_null_audio_backend();
+
+    set_music_mode(get_game_options()->music_mode);
+
+    if (get_game_options()->software_sfx_mixer)
+        use_software_sfx_mixer();
+
     if (!init_all_necessary_allegro_components() || 
             !install_all_necessary_allegro_components()) 
         return -1;
 
-    if (!init_game_components()) 
+    if (get_game_options()->perf_log_path && !open_perf_log(get_game_options()->perf_log_path))
         return -1;
 
+    if (get_game_options()->verify_replay_path) {
+        if (!init_game_components()) 
+            return -1;
+
+        init_game_clock();
+        load_sounds();
+        init_game_context();
+
+        int result = verify_replay(get_game_options()->verify_replay_path);
+
+        close_perf_log();
+        destroy_playing_session();
+        destroy_sound_bank();
+        destroy_sprite_cache();
+        destroy_game_context();
+
+        return result;
+    }
+
     timer = al_create_timer(FPS);
     if (!timer) {
         fprintf(stderr, "Failed to create timer.\n");
@@ -140,41 +322,47 @@ int main() {
         return -1;
     }
 
+    // Fontes e sprites carregados com o display já criado são bitmaps de vídeo, qualquer bitmap 
+    // que ainda tenha ficado em memória é convertido depois do carregamento.
+    if (!init_game_components()) 
+        return -1;
+
     set_time_seed();
+    init_game_clock();
     load_sounds();
     init_game_context();
+    al_convert_memory_bitmaps();
+
+    if (get_game_options()->audit_bitmaps)
+        enable_bitmap_audit();
+
+    if (get_game_options()->record_replay_path && 
+            !start_replay_recording(get_game_options()->record_replay_path))
+        return -1;
 
     al_register_event_source(queue, al_get_display_event_source(display));
     al_register_event_source(queue, al_get_keyboard_event_source());
     al_register_event_source(queue, al_get_mouse_event_source());
     al_register_event_source(queue, al_get_timer_event_source(timer));
-    
-    al_start_timer(timer);
 
     set_game_state(STATE_MENU, true);
 
-    while (is_running) {
-         al_wait_for_event(queue, &event);
+    if (get_game_options()->turbo)
+        run_turbo_loop(queue);
+    else
+        run_timed_loop(queue, timer);
 
-        if (event.type == ALLEGRO_EVENT_KEY_UP || 
-             event.type == ALLEGRO_EVENT_KEY_DOWN ||
-             event.type == ALLEGRO_EVENT_DISPLAY_CLOSE)  {
-            handle_input(event);
-        }
-                  
-        if (event.type == ALLEGRO_EVENT_TIMER) {
-            is_running = update();
-            redraw = true;
-        }
-
-        if (redraw && al_is_event_queue_empty(queue)) {
-            draw();
-            redraw = false;
-        }
-    }
+    stop_replay_recording();
+    write_audio_stats_to_perf_log();
+    close_perf_log();
 
-    save_scores_to_file(get_score_table(), SCORES_PATH);
+    if (!get_game_options()->autopilot)
+        save_scores_to_file(get_score_table(), SCORES_PATH);
+    destroy_playing_session();
     destroy_sound_bank();
+    destroy_screen_cache();
+    wait_asset_loading();
+    destroy_sprite_cache();
     al_destroy_display(display);
     al_destroy_event_queue(queue);
     al_destroy_timer(timer);
@@ -0,0 +1,46 @@
+#include "game_clock.h"
+
+/**
+ * @brief Estrutura que representa o relógio da simulação. O tempo avança somente
+ * a cada tick do game, o que torna a simulação independente do relógio real e 
+ * permite que o tempo seja salvo e restaurado junto com o restante do estado.
+ */
+typedef struct GameClock {
+    double time;
+} GameClock;
+
+static GameClock gclock;
+
+/**
+ * @brief Inicializa o relógio da simulação.
+ */
+void init_game_clock() {
+    gclock.time = 0;
+}
+
+/**
+ * @brief Avança o relógio da simulação.
+ * 
+ * @param delta_time Tempo em segundos a ser adicionado ao relógio.
+ */
+void advance_game_clock(double delta_time) {
+    gclock.time += delta_time;
+}
+
+/**
+ * @brief Retorna o tempo atual da simulação.
+ * 
+ * @return Tempo em segundos desde o início da simulação.
+ */
+double get_game_time() {
+    return gclock.time;
+}
+
+/**
+ * @brief Define o tempo atual da simulação.
+ * 
+ * @param time Tempo em segundos.
+ */
+void set_game_time(double time) {
+    gclock.time = time;
+}
@@ -48,6 +48,7 @@ void set_up_stage_manager() {
 void set_up_background_manager() {
     gc.bg_manager = create_background_manager();
     init_background_manager(gc.bg_manager);
+    preload_backgrounds(gc.bg_manager);
 }
 
 /**
@@ -0,0 +1,161 @@
+#include "game_options.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "utils.h"
+
+#define RECORD_REPLAY_OPTION "--record-replay="
+#define VERIFY_REPLAY_OPTION "--verify-replay="
+#define TURBO_OPTION "--turbo="
+#define MUSIC_OPTION "--music="
+#define PERF_LOG_OPTION "--perf-log="
+#define DEFAULT_TURBO_RENDER_INTERVAL 60
+
+static GameOptions options = {
+    .practice_mode = false,
+    .record_replay_path = NULL,
+    .verify_replay_path = NULL,
+    .turbo = false,
+    .turbo_render_interval = DEFAULT_TURBO_RENDER_INTERVAL,
+    .autopilot = false,
+    .no_audio = false,
+    .music_mode = MUSIC_STREAMED,
+    .software_sfx_mixer = false,
+    .audit_bitmaps = false,
+    .low_power = false,
+    .perf_log_path = NULL,
+};
+
+/**
+ * @brief Printa no terminal as opções aceitas pelo programa.
+ * 
+ * @param program Nome do executável.
+ */
+void print_usage(const char *program) {
+    fprintf(stderr, "Usage: %s [options]\n", program);
+    fprintf(stderr, "  --practice              Enable practice mode (hold R to rewind gameplay).\n");
+    fprintf(stderr, "  --record-replay=FILE    Record inputs and per-tick state hashes to FILE.\n");
+    fprintf(stderr, "  --verify-replay=FILE    Replay FILE without a window and report the first desync.\n");
+    fprintf(stderr, "  --turbo[=N]             Run ticks back to back, drawing every Nth tick (default %d, 0 = never).\n",
+        DEFAULT_TURBO_RENDER_INTERVAL);
+    fprintf(stderr, "  --autopilot             Let the game play itself (menus included).\n");
+    fprintf(stderr, "  --no-audio              Use the null audio backend (no device, no decoding).\n");
+    fprintf(stderr, "  --music=MODE            stream (default), decoded (decode once at startup, ~10 MB per\n");
+    fprintf(stderr, "                          minute of stereo music) or cache (decoded, reused from %s).\n",
+        MUSIC_CACHE_DIR);
+    fprintf(stderr, "  --sfx-mixer             Mix sound effects in software (%s kernel, up to %d voices).\n",
+        get_sfx_mixer_kernel(), SFX_MIXER_VOICES);
+    fprintf(stderr, "  --audit-bitmaps         Debug: report every frame that draws a memory (software) bitmap.\n");
+    fprintf(stderr, "  --low-power             Stop the frame timer on static screens, redrawing only on input.\n");
+    fprintf(stderr, "  --perf-log=FILE         Append performance counters (audio latency, stream underruns) to FILE.\n");
+}
+
+/**
+ * @brief Converte o valor da opção --music para um MusicMode.
+ * 
+ * @param value Valor da opção.
+ * @param mode Ponteiro que recebe o MusicMode.
+ * 
+ * @return Bool indicando se o valor era válido.
+ */
+bool parse_music_mode(const char *value, MusicMode *mode) {
+    if (strcmp(value, "stream") == 0) *mode = MUSIC_STREAMED;
+    else if (strcmp(value, "decoded") == 0) *mode = MUSIC_DECODED;
+    else if (strcmp(value, "cache") == 0) *mode = MUSIC_PCM_CACHE;
+    else return false;
+
+    return true;
+}
+
+/**
+ * @brief Interpreta os argumentos da linha de comando e preenche as opções do game.
+ * 
+ * @param argc Quantidade de argumentos.
+ * @param argv Vetor de argumentos.
+ * 
+ * @return Bool indicando se todos os argumentos eram válidos.
+ */
+bool parse_game_options(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--practice") == 0) {
+            options.practice_mode = true;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--turbo") == 0) {
+            options.turbo = true;
+            continue;
+        }
+
+        if (strncmp(argv[i], TURBO_OPTION, strlen(TURBO_OPTION)) == 0 && 
+                is_valid_number(argv[i] + strlen(TURBO_OPTION))) {
+            options.turbo = true;
+            options.turbo_render_interval = atoi(argv[i] + strlen(TURBO_OPTION));
+            continue;
+        }
+
+        if (strcmp(argv[i], "--autopilot") == 0) {
+            options.autopilot = true;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--no-audio") == 0) {
+            options.no_audio = true;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--sfx-mixer") == 0) {
+            options.software_sfx_mixer = true;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--audit-bitmaps") == 0) {
+            options.audit_bitmaps = true;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--low-power") == 0) {
+            options.low_power = true;
+            continue;
+        }
+
+        if (strncmp(argv[i], MUSIC_OPTION, strlen(MUSIC_OPTION)) == 0 && 
+                parse_music_mode(argv[i] + strlen(MUSIC_OPTION), &options.music_mode))
+            continue;
+
+        if (strncmp(argv[i], PERF_LOG_OPTION, strlen(PERF_LOG_OPTION)) == 0) {
+            options.perf_log_path = argv[i] + strlen(PERF_LOG_OPTION);
+            continue;
+        }
+
+        if (strncmp(argv[i], RECORD_REPLAY_OPTION, strlen(RECORD_REPLAY_OPTION)) == 0) {
+            options.record_replay_path = argv[i] + strlen(RECORD_REPLAY_OPTION);
+            continue;
+        }
+
+        if (strncmp(argv[i], VERIFY_REPLAY_OPTION, strlen(VERIFY_REPLAY_OPTION)) == 0) {
+            options.verify_replay_path = argv[i] + strlen(VERIFY_REPLAY_OPTION);
+            continue;
+        }
+
+        fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        print_usage(argv[0]);
+        return false;
+    }
+
+    if (options.practice_mode && (options.record_replay_path || options.verify_replay_path)) {
+        fprintf(stderr, "Replays can't be recorded or verified in practice mode.\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Retorna as opções do game.
+ * 
+ * @return Ponteiro para GameOptions.
+ */
+GameOptions *get_game_options() {
+    return &options;
+}
@@ -1,14 +1,39 @@
 #include "background_manager.h"
+#include "bitmap_audit.h"
+#include "asset_paths.h"
+#include <string.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <allegro5/allegro.h>
 
+static const char *background_paths[] = {
+    MENU_BG_PATH,
+    PLAYING_BG_PATH,
+    GAME_OVER_BG_PATH,
+    SAVE_SCORE_BG_PATH,
+    SCORE_RANK_BG_PATH,
+};
+
+/**
+ * @brief Entrada do cache de backgrounds: o bitmap carregado, o caminho de onde veio e quando foi 
+ * usado pela última vez (para escolher quem sai quando o cache está cheio).
+ */
+typedef struct CachedBackground {
+    char path[PATH_MAX];
+    ALLEGRO_BITMAP *bitmap;
+    unsigned long last_used;
+} CachedBackground;
+
 /**
- * @brief Estrutura usada para armazenar um ALLEGRO_BITMAP que será utilizada 
- * para representa o background nos vários estado do game.
+ * @brief Estrutura usada para armazenar os ALLEGRO_BITMAP que serão utilizados 
+ * para representar o background nos vários estado do game. Os backgrounds ficam residentes no 
+ * cache e trocar de background é só trocar o ponteiro background.
  */
 typedef struct BackgroundManager {
     ALLEGRO_BITMAP *background;
+    CachedBackground cache[BACKGROUND_CACHE_SIZE];
+    unsigned long uses;
 } BackgroundManager;    
 
 /**
@@ -34,6 +59,13 @@ BackgroundManager* create_background_manager() {
  */
 void init_background_manager(BackgroundManager *manager) {
     manager->background = NULL;
+    manager->uses = 0;
+
+    for (int i = 0; i < BACKGROUND_CACHE_SIZE; i++) {
+        manager->cache[i].path[0] = '\0';
+        manager->cache[i].bitmap = NULL;
+        manager->cache[i].last_used = 0;
+    }
 }
 
 /**
@@ -48,21 +80,96 @@ void destroy_background(ALLEGRO_BITMAP *background) {
 }
 
 /**
- * @brief Carrega um ALLEGRO_BITMAP.
+ * @brief Procura um background no cache.
+ * 
+ * @param manager Ponteiro para o BackgroundManager.
+ * @param path Caminho da imagem.
+ * 
+ * @return Ponteiro para a entrada do cache ou NULL se o background não foi carregado.
+ */
+CachedBackground *find_cached_background(BackgroundManager *manager, const char *path) {
+    for (int i = 0; i < BACKGROUND_CACHE_SIZE; i++) {
+        if (manager->cache[i].bitmap && strcmp(manager->cache[i].path, path) == 0)
+            return &manager->cache[i];
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Escolhe a entrada do cache que vai receber um novo background, uma entrada vazia ou, 
+ * com o cache cheio, a usada há mais tempo (que nunca é o background atual).
+ * 
+ * @param manager Ponteiro para o BackgroundManager.
+ * 
+ * @return Ponteiro para a entrada escolhida, já liberada.
+ */
+CachedBackground *get_free_cached_background(BackgroundManager *manager) {
+    CachedBackground *entry = &manager->cache[0];
+
+    for (int i = 0; i < BACKGROUND_CACHE_SIZE; i++) {
+        if (!manager->cache[i].bitmap) return &manager->cache[i];
+
+        if (manager->cache[i].last_used < entry->last_used)
+            entry = &manager->cache[i];
+    }
+
+    destroy_background(entry->bitmap);
+    entry->bitmap = NULL;
+
+    return entry;
+}
+
+/**
+ * @brief Carrega um background do disco para o cache, caso ainda não esteja nele.
  * 
  * @param manager Ponteiro para o BackgroundManager.
  * @param path Caminho para a imagem a ser carregada.
+ * 
+ * @return Ponteiro para a entrada do cache com o background.
  */
-void load_background(BackgroundManager *manager, const char *path) {
-    if (manager->background) 
-        destroy_background(manager->background);
+CachedBackground *cache_background(BackgroundManager *manager, const char *path) {
+    CachedBackground *entry = find_cached_background(manager, path);
+
+    if (entry) return entry;
 
-    manager->background = al_load_bitmap(path);
+    entry = get_free_cached_background(manager);
+    entry->bitmap = al_load_bitmap(path);
 
-    if (!manager->background) {
+    if (!entry->bitmap) {
         fprintf(stderr, "Failed to load background at path: %s\n", path);
         exit(-1);
     }
+
+    snprintf(entry->path, sizeof(entry->path), "%s", path);
+
+    return entry;
+}
+
+/**
+ * @brief Carrega todos os backgrounds do game no cache, assim a entrada nos estados não faz I/O. 
+ * Deve ser chamada depois da criação do display para que os bitmaps sejam de vídeo.
+ * 
+ * @param manager Ponteiro para o BackgroundManager.
+ */
+void preload_backgrounds(BackgroundManager *manager) {
+    int count = sizeof(background_paths) / sizeof(background_paths[0]);
+
+    for (int i = 0; i < count; i++)
+        cache_background(manager, background_paths[i]);
+}
+
+/**
+ * @brief Define o background atual, carregando-o somente se ainda não estiver no cache.
+ * 
+ * @param manager Ponteiro para o BackgroundManager.
+ * @param path Caminho para a imagem a ser carregada.
+ */
+void load_background(BackgroundManager *manager, const char *path) {
+    CachedBackground *entry = cache_background(manager, path);
+
+    entry->last_used = ++manager->uses;
+    manager->background = entry->bitmap;
 }
 
 /**
@@ -71,8 +178,10 @@ void load_background(BackgroundManager *manager, const char *path) {
  * @param manager Ponteiro para um BackgroundManager.
  */
 void draw_background(BackgroundManager *manager) {
-    if (manager->background)
+    if (manager->background) {
+        audit_bitmap(manager->background, "draw_background");
         al_draw_bitmap(manager->background, 0, 0, 0);
+    }
 }
 
 
@@ -83,7 +192,9 @@ void draw_background(BackgroundManager *manager) {
  */
 void destroy_background_manager(BackgroundManager *manager) {
     if (!manager) return;
-    if (manager->background)
-        destroy_background(manager->background);
+
+    for (int i = 0; i < BACKGROUND_CACHE_SIZE; i++)
+        destroy_background(manager->cache[i].bitmap);
+
     free(manager);
 }
\ No newline at end of file
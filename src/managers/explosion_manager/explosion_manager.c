@@ -2,12 +2,14 @@
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_image.h>
 #include "animator.h"
+#include "snapshot.h"
+#include "sprite_cache.h"
+#include "asset_paths.h"
+#include "session_arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
 
-#define EXPLOSION_SPRITE_PATH "../assets/images/sprites/explosion.png"
-
 #define EXPLOSION_WIDTH 40
 #define EXPLOSION_HEIGHT 40
 #define EXPLOSION_FRAMES 6
@@ -36,17 +38,12 @@ typedef struct ExplosionManager {
 } ExplosionManager;
 
 /**
- * @brief Alloca memoria para um ExplosionManager.
+ * @brief Alloca um ExplosionManager na arena da sessão.
  * 
  * @return ExplosionManager.
  */
 ExplosionManager* create_explosion_manager() {
-    ExplosionManager *manager = (ExplosionManager *) malloc(sizeof(ExplosionManager));
-
-    if (!manager) {
-        fprintf(stderr, "Failed to create explosion manager.\n");
-        exit(-1);
-    }
+    ExplosionManager *manager = (ExplosionManager *) session_alloc(sizeof(ExplosionManager));
 
     return manager;
 }
@@ -66,32 +63,24 @@ Explosion create_explosion(const char *sprite_path, Animator *animator, float du
     explosion.animator = animator;
     explosion.active = false;
     explosion.duration = duration; 
+    explosion.pos = (Point) {0, 0};
+    explosion.timer = 0;
 
     return explosion;
 }
 
 /**
- * @brief Inicializa o gerenciador de explosões.
+ * @brief Inicializa o gerenciador de explosões, as explosões e seus animators vêm da arena da sessão.
  * 
  * @param manager Ponteiro para o ExplosionManager.
  * @param max Quantidade máxima de exlosões suportadas.
  */
 void init_explosion_manager(ExplosionManager *manager, int max) {
     manager->max = max;
-    manager->explosions = (Explosion *) malloc(sizeof(Explosion) * max);
-
-    if (!manager->explosions) {
-        fprintf(stderr, "Failed to create explosions array.\n");
-        exit(-1);
-    } 
+    manager->explosions = (Explosion *) session_alloc(sizeof(Explosion) * max);
 
     for (int i = 0; i < max; i++) {
-        Animator *animator = (Animator *) malloc(sizeof(Animator));
-    
-        if (!animator) {
-            fprintf(stderr, "Failed to create animator.\n");
-            exit(-1);
-        }
+        Animator *animator = (Animator *) session_alloc(sizeof(Animator));
 
         init_animator(animator, EXPLOSION_FRAMES, EXPLOSION_WIDTH, 
             EXPLOSION_HEIGHT, EXPLOSION_FRAME_DURATION, false);
@@ -103,6 +92,26 @@ void init_explosion_manager(ExplosionManager *manager, int max) {
     manager->count = 0;
 }
 
+/**
+ * @brief Desativa todas as explosões e reinicia suas animações, usada para reaproveitar o 
+ * gerenciador em um novo estágio.
+ * 
+ * @param manager Ponteiro para o ExplosionManager.
+ */
+void reset_explosion_manager(ExplosionManager *manager) {
+    for (int i = 0; i < manager->max; i++) {
+        Explosion *explosion = &manager->explosions[i];
+
+        init_animator(explosion->animator, EXPLOSION_FRAMES, EXPLOSION_WIDTH, 
+            EXPLOSION_HEIGHT, EXPLOSION_FRAME_DURATION, false);
+        explosion->active = false;
+        explosion->pos = (Point) {0, 0};
+        explosion->timer = 0;
+    }
+
+    manager->count = 0;
+}
+
 /**
  * @brief Ativa uma explosão.
  * 
@@ -180,38 +189,54 @@ void draw_explosions(ExplosionManager *manager) {
 }  
 
 /**
- * @brief Libera os recursos utilizados pela Explosion.
+ * @brief Copia o estado mutável das explosões para um ExplosionPoolState.
  * 
- * @param explosion Ponteiro para uma Explosion.
+ * @param manager Ponteiro para o ExplosionManager.
+ * @param state Ponteiro para o ExplosionPoolState que receberá o estado.
+ * 
+ * @return Bool indicando se o estado coube no ExplosionPoolState.
  */
-void destroy_explosion(Explosion *explosion) {
-    if (explosion->sprite) al_destroy_bitmap(explosion->sprite);
-    if (explosion->animator) destroy_animator(explosion->animator);
+bool save_explosions_state(ExplosionManager *manager, ExplosionPoolState *state) {
+    if (manager->max > SNAPSHOT_MAX_EXPLOSIONS) return false;
+
+    state->max = manager->max;
+    state->count = manager->count;
+
+    for (int i = 0; i < manager->max; i++) {
+        Explosion *explosion = &manager->explosions[i];
+        ExplosionState *explosion_state = &state->explosions[i];
+
+        explosion_state->pos = explosion->pos;
+        explosion_state->timer = explosion->timer;
+        explosion_state->active = explosion->active;
+        save_animator_state(explosion->animator, &explosion_state->animator);
+    }
+
+    return true;
 }
 
 /**
- * @brief Libera os recursos utilizados por todas as explosões do game.
+ * @brief Restaura o estado mutável das explosões a partir de um ExplosionPoolState.
  * 
  * @param manager Ponteiro para o ExplosionManager.
+ * @param state Ponteiro para o ExplosionPoolState salvo.
+ * 
+ * @return Bool indicando se o estado é compatível com o ExplosionManager e foi restaurado.
  */
-void destroy_explosions(ExplosionManager *manager) {
-    for (int i = 0; i < manager->max; i++) 
-        destroy_explosion(&manager->explosions[i]);
-
-    free(manager->explosions);
-}
+bool restore_explosions_state(ExplosionManager *manager, const ExplosionPoolState *state) {
+    if (state->max != manager->max) return false;
 
+    manager->count = state->count;
 
-/**
- * @brief Libera os recursos utilizados pelo ExplosionManager.
- * 
- * @param manager Ponteiro para o ExplosionManger.
- */
-void destroy_explosion_manager(ExplosionManager *manager) {
-    if (!manager) return;
+    for (int i = 0; i < manager->max; i++) {
+        Explosion *explosion = &manager->explosions[i];
+        const ExplosionState *explosion_state = &state->explosions[i];
 
-    if (manager->explosions) 
-        destroy_explosions(manager);   
+        explosion->pos = explosion_state->pos;
+        explosion->timer = explosion_state->timer;
+        explosion->active = explosion_state->active;
+        restore_animator_state(explosion->animator, &explosion_state->animator);
+    }
 
-    free(manager);
-}
\ No newline at end of file
+    return true;
+}
@@ -1,7 +1,9 @@
 #include "font_manager.h"
+#include <allegro5/allegro.h>
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro_ttf.h>
 #include <stdio.h>
+#include <limits.h>
 
 #define FONT1_PATH "../assets/fonts/PixelEmulator.ttf"
 #define FONT2_PATH "../assets/fonts/PressStart2P.ttf"
@@ -17,24 +19,43 @@
 static FontManager fm;
 
 /**
- * @brief Tentar carregar um ttf fonte, se for possível retorna true, caso contrário, falso.
+ * @brief Fontes disponíveis, em ordem de preferência.
+ */
+static const FontSpec font_specs[] = {
+    {FONT1_PATH, "pixel_emulator", {SMALL_FONT1_SIZE, MEDIUM_FONT1_SIZE, LARGE_FONT1_SIZE}},
+    {FONT2_PATH, "press_start_2p", {SMALL_FONT2_SIZE, MEDIUM_FONT2_SIZE, LARGE_FONT2_SIZE}},
+};
+
+/**
+ * @brief Retorna as fontes disponíveis, em ordem de preferência.
  * 
- * @param path Caminho para o fonte.
- * @param small Tamanho para a fonte pequenha.
- * @param medium Tamanho para a fonte média.
- * @param large Tamanho para a fonte grande.
+ * @param count Ponteiro que recebe a quantidade de fontes.
  * 
- * @return Bool indicando se foi possível carregar uma das duas fontes.
+ * @return Vetor de FontSpec.
  */
-bool try_load_font(const char *path, int small, int medium, int large) {
-    ALLEGRO_FONT *small_f = al_load_ttf_font(path, small, 0);
-    ALLEGRO_FONT *medium_f = al_load_ttf_font(path, medium, 0);
-    ALLEGRO_FONT *large_f = al_load_ttf_font(path, large, 0);
+const FontSpec *get_font_specs(int *count) {
+    *count = sizeof(font_specs) / sizeof(font_specs[0]);
+    return font_specs;
+}
 
+/**
+ * @brief Monta o caminho do atlas pré-gerado de uma fonte, ex: "../assets/fonts/baked/pixel_emulator_16.png".
+ * 
+ * @param path Buffer com PATH_MAX bytes que recebe o caminho.
+ * @param name Nome da fonte.
+ * @param size Tamanho da fonte.
+ */
+void get_font_atlas_path(char *path, const char *name, int size) {
+    snprintf(path, PATH_MAX, "%s/%s_%d.png", FONT_ATLAS_DIR, name, size);
+}
 
+/**
+ * @brief Guarda as três fontes no FontManager, se alguma delas não foi carregada todas são liberadas.
+ * 
+ * @return Bool indicando se as três fontes foram carregadas.
+ */
+bool set_fonts(ALLEGRO_FONT *small_f, ALLEGRO_FONT *medium_f, ALLEGRO_FONT *large_f) {
     if (!small_f || !medium_f || !large_f) {
-        fprintf(stderr, "Failed to lond font in path: %s\n", path);
-
         if (small_f) al_destroy_font(small_f);
         if (medium_f) al_destroy_font(medium_f);
         if (large_f) al_destroy_font(large_f);
@@ -50,22 +71,91 @@ bool try_load_font(const char *path, int small, int medium, int large) {
 }
 
 /**
- * @brief Inicializa as bibliotecas allegro necessárias e tenta carregar uma das duas fontes 
- * disponíveis, retorna true caso isso ocorra normalmente, caso algum passo falhe retorna falso.
+ * @brief Carrega o atlas pré-gerado (tools/bake_fonts) de uma fonte em um tamanho. Os glifos e suas 
+ * larguras vêm prontos da imagem, sem FreeType e sem rasterização durante o jogo.
+ * 
+ * @param name Nome da fonte.
+ * @param size Tamanho da fonte.
+ * 
+ * @return ALLEGRO_FONT ou NULL se o atlas não existe.
+ */
+ALLEGRO_FONT *load_font_atlas(const char *name, int size) {
+    static const int ranges[] = {FONT_ATLAS_FIRST_GLYPH, FONT_ATLAS_LAST_GLYPH};
+    char path[PATH_MAX];
+
+    get_font_atlas_path(path, name, size);
+
+    ALLEGRO_BITMAP *atlas = al_load_bitmap(path);
+    if (!atlas) return NULL;
+
+    ALLEGRO_FONT *font = al_grab_font_from_bitmap(atlas, 1, ranges);
+    al_destroy_bitmap(atlas);
+
+    return font;
+}
+
+/**
+ * @brief Tenta carregar os atlas pré-gerados de uma fonte nos três tamanhos.
+ * 
+ * @param spec Ponteiro para FontSpec.
+ * 
+ * @return Bool indicando se os três atlas foram carregados.
+ */
+bool try_load_font_atlases(const FontSpec *spec) {
+    return set_fonts(
+        load_font_atlas(spec->name, spec->sizes[FONT_SMALL]),
+        load_font_atlas(spec->name, spec->sizes[FONT_MEDIUM]),
+        load_font_atlas(spec->name, spec->sizes[FONT_LARGE]));
+}
+
+/**
+ * @brief Tentar carregar um ttf fonte, se for possível retorna true, caso contrário, falso.
+ * 
+ * @param spec Ponteiro para FontSpec com o caminho e os tamanhos da fonte.
+ * 
+ * @return Bool indicando se foi possível carregar a fonte nos três tamanhos.
+ */
+bool try_load_font(const FontSpec *spec) {
+    bool loaded = set_fonts(
+        al_load_ttf_font(spec->path, spec->sizes[FONT_SMALL], 0),
+        al_load_ttf_font(spec->path, spec->sizes[FONT_MEDIUM], 0),
+        al_load_ttf_font(spec->path, spec->sizes[FONT_LARGE], 0));
+
+    if (!loaded)
+        fprintf(stderr, "Failed to lond font in path: %s\n", spec->path);
+
+    return loaded;
+}
+
+/**
+ * @brief Inicializa as bibliotecas allegro necessárias e carrega as fontes. Os atlas pré-gerados 
+ * são usados quando existem (make fonts), senão uma das duas fontes TTF é carregada. Retorna falso 
+ * se nenhuma fonte pôde ser carregada.
  * 
  * @return Bool indicando se foi possível iniciar os módulos do allegro responsáveis por lidar com fontes.
  */
 bool init_font_manager() {
-    if (!al_init_font_addon() || !al_init_ttf_addon()) {
-        fprintf(stderr, 
-            "Unable to init font manager. Font addon or ttf addon wasn't initialized..\n");
+    int count = sizeof(font_specs) / sizeof(font_specs[0]);
+
+    if (!al_init_font_addon()) {
+        fprintf(stderr, "Unable to init font manager. Font addon wasn't initialized..\n");
         return false;
     }
 
-    if (!try_load_font(FONT1_PATH, SMALL_FONT1_SIZE, MEDIUM_FONT1_SIZE, LARGE_FONT1_SIZE)) 
-        return try_load_font(FONT2_PATH, SMALL_FONT2_SIZE, MEDIUM_FONT2_SIZE, LARGE_FONT2_SIZE);
+    for (int i = 0; i < count; i++) {
+        if (try_load_font_atlases(&font_specs[i])) return true;
+    }
 
-    return true;
+    if (!al_init_ttf_addon()) {
+        fprintf(stderr, "Unable to init font manager. Ttf addon wasn't initialized..\n");
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (try_load_font(&font_specs[i])) return true;
+    }
+
+    return false;
 }
 
 /**
@@ -0,0 +1,67 @@
+#include "audio_queue.h"
+
+/**
+ * @brief Inicializa uma fila de comandos de áudio vazia.
+ * 
+ * @param queue Ponteiro para AudioQueue.
+ */
+void init_audio_queue(AudioQueue *queue) {
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->dropped, 0);
+}
+
+/**
+ * @brief Adiciona um comando na fila, deve ser chamada somente pelo produtor. Nunca bloqueia, 
+ * se a fila estiver cheia o comando é descartado.
+ * 
+ * @param queue Ponteiro para AudioQueue.
+ * @param command Comando a ser adicionado.
+ * 
+ * @return Bool indicando se o comando foi adicionado.
+ */
+bool push_audio_command(AudioQueue *queue, AudioCommand command) {
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    if (tail - head == AUDIO_QUEUE_SIZE) {
+        atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+        return false;
+    }
+
+    queue->commands[tail % AUDIO_QUEUE_SIZE] = command;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Remove o comando mais antigo da fila, deve ser chamada somente pelo consumidor.
+ * 
+ * @param queue Ponteiro para AudioQueue.
+ * @param command Ponteiro que receberá o comando.
+ * 
+ * @return Bool indicando se havia algum comando na fila.
+ */
+bool pop_audio_command(AudioQueue *queue, AudioCommand *command) {
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    if (head == tail) return false;
+
+    *command = queue->commands[head % AUDIO_QUEUE_SIZE];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Retorna quantos comandos foram descartados por a fila estar cheia.
+ * 
+ * @param queue Ponteiro para AudioQueue.
+ * 
+ * @return Quantidade de comandos descartados.
+ */
+unsigned int get_dropped_audio_commands(AudioQueue *queue) {
+    return atomic_load_explicit(&queue->dropped, memory_order_relaxed);
+}
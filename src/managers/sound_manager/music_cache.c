@@ -0,0 +1,176 @@
+#include "music_cache.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Monta o caminho do arquivo de cache de uma música, ex: "../assets/music/main_game.ogg" 
+ * vira "../cache/main_game.ogg.pcm".
+ * 
+ * @param music_path Caminho da música.
+ * @param cache_path Buffer com PATH_MAX bytes que recebe o caminho do cache.
+ */
+void get_music_cache_path(const char *music_path, char *cache_path) {
+    const char *name = strrchr(music_path, '/');
+
+    snprintf(cache_path, PATH_MAX, "%s/%s.pcm", MUSIC_CACHE_DIR, name ? name + 1 : music_path);
+}
+
+/**
+ * @brief Verifica se o cabeçalho do cache é válido para a música original.
+ * 
+ * @param header Ponteiro para o cabeçalho lido.
+ * @param source Informações do arquivo original.
+ * @param file_size Tamanho do arquivo de cache.
+ * 
+ * @return Bool indicando se o cache pode ser usado.
+ */
+bool is_music_cache_valid(const MusicCacheHeader *header, const struct stat *source, size_t file_size) {
+    return header->magic == MUSIC_CACHE_MAGIC &&
+        header->version == MUSIC_CACHE_VERSION &&
+        header->source_size == (uint64_t) source->st_size &&
+        header->source_mtime == (int64_t) source->st_mtime &&
+        header->data_size == file_size - MUSIC_CACHE_HEADER_SIZE &&
+        header->data_size == (uint64_t) header->length * 
+            al_get_channel_count(header->channels) * al_get_audio_depth_size(header->depth);
+}
+
+/**
+ * @brief Mapeia um arquivo de cache em memória e cria um sample que usa os dados mapeados 
+ * sem copiá-los.
+ * 
+ * @param cache_path Caminho do arquivo de cache.
+ * @param source Informações do arquivo original.
+ * 
+ * @return CachedMusic, com sample NULL se o cache não existe ou está desatualizado.
+ */
+CachedMusic map_music_cache(const char *cache_path, const struct stat *source) {
+    CachedMusic cached = {NULL, NULL, 0};
+    struct stat cache;
+    int fd = open(cache_path, O_RDONLY);
+
+    if (fd < 0) return cached;
+
+    if (fstat(fd, &cache) != 0 || cache.st_size <= MUSIC_CACHE_HEADER_SIZE) {
+        close(fd);
+        return cached;
+    }
+
+    void *map = mmap(NULL, cache.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED) return cached;
+
+    const MusicCacheHeader *header = (const MusicCacheHeader *) map;
+
+    if (!is_music_cache_valid(header, source, cache.st_size)) {
+        munmap(map, cache.st_size);
+        return cached;
+    }
+
+    cached.sample = al_create_sample((char *) map + MUSIC_CACHE_HEADER_SIZE, header->length,
+        header->frequency, header->depth, header->channels, false);
+
+    if (!cached.sample) {
+        munmap(map, cache.st_size);
+        return cached;
+    }
+
+    cached.map = map;
+    cached.map_size = cache.st_size;
+
+    return cached;
+}
+
+/**
+ * @brief Grava os samples decodificados de uma música em um arquivo de cache. Uma falha 
+ * aqui não é fatal, a música só será decodificada de novo na próxima execução.
+ * 
+ * @param cache_path Caminho do arquivo de cache.
+ * @param sample Sample decodificado.
+ * @param source Informações do arquivo original.
+ */
+void write_music_cache(const char *cache_path, ALLEGRO_SAMPLE *sample, const struct stat *source) {
+    char header_bytes[MUSIC_CACHE_HEADER_SIZE] = {0};
+    MusicCacheHeader header = {
+        .magic = MUSIC_CACHE_MAGIC,
+        .version = MUSIC_CACHE_VERSION,
+        .frequency = al_get_sample_frequency(sample),
+        .channels = al_get_sample_channels(sample),
+        .depth = al_get_sample_depth(sample),
+        .length = al_get_sample_length(sample),
+        .source_size = source->st_size,
+        .source_mtime = source->st_mtime,
+    };
+
+    header.data_size = (uint64_t) header.length * 
+        al_get_channel_count(header.channels) * al_get_audio_depth_size(header.depth);
+    memcpy(header_bytes, &header, sizeof(header));
+
+    if (mkdir(MUSIC_CACHE_DIR, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Unable to create music cache dir %s.\n", MUSIC_CACHE_DIR);
+        return;
+    }
+
+    FILE *file = fopen(cache_path, "wb");
+
+    if (!file) {
+        fprintf(stderr, "Unable to write music cache %s.\n", cache_path);
+        return;
+    }
+
+    bool written = fwrite(header_bytes, sizeof(header_bytes), 1, file) == 1 &&
+        fwrite(al_get_sample_data(sample), header.data_size, 1, file) == 1;
+
+    if (fclose(file) != 0 || !written) {
+        fprintf(stderr, "Unable to write music cache %s.\n", cache_path);
+        remove(cache_path);
+    }
+}
+
+/**
+ * @brief Carrega uma música já decodificada. Se existir um cache PCM válido ele é mapeado em 
+ * memória, senão a música é decodificada inteira e o cache é gravado para as próximas execuções.
+ * 
+ * @param music_path Caminho da música.
+ * 
+ * @return CachedMusic, com sample NULL se a música não pôde ser carregada.
+ */
+CachedMusic load_cached_music(const char *music_path) {
+    CachedMusic cached = {NULL, NULL, 0};
+    char cache_path[PATH_MAX];
+    struct stat source;
+
+    if (stat(music_path, &source) != 0) return cached;
+
+    get_music_cache_path(music_path, cache_path);
+    cached = map_music_cache(cache_path, &source);
+
+    if (cached.sample) return cached;
+
+    cached.sample = al_load_sample(music_path);
+
+    if (cached.sample)
+        write_music_cache(cache_path, cached.sample, &source);
+
+    return cached;
+}
+
+/**
+ * @brief Libera o sample e o mapeamento de uma música carregada do cache.
+ * 
+ * @param cached Ponteiro para CachedMusic.
+ */
+void release_cached_music(CachedMusic *cached) {
+    if (cached->sample) al_destroy_sample(cached->sample);
+    if (cached->map) munmap(cached->map, cached->map_size);
+
+    cached->sample = NULL;
+    cached->map = NULL;
+    cached->map_size = 0;
+}
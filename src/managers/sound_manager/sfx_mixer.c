@@ -0,0 +1,310 @@
+#include "sfx_mixer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#if defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Lê um sample de PCM e o converte para float entre -1 e 1.
+ * 
+ * @param pcm Buffer de PCM.
+ * @param index Índice do sample (frame * canais + canal).
+ * @param format Formato do PCM.
+ * 
+ * @return Valor do sample.
+ */
+float read_pcm_sample(const void *pcm, unsigned int index, MixerPcmFormat format) {
+    switch (format) {
+        case MIXER_PCM_INT8:
+            return ((const int8_t *) pcm)[index] / 128.0f;
+        case MIXER_PCM_UINT8:
+            return (((const uint8_t *) pcm)[index] - 128) / 128.0f;
+        case MIXER_PCM_INT16:
+            return ((const int16_t *) pcm)[index] / 32768.0f;
+        case MIXER_PCM_FLOAT32:
+        default:
+            return ((const float *) pcm)[index];
+    }
+}
+
+/**
+ * @brief Converte um sample para o formato do mixer (float estéreo em SFX_MIXER_FREQUENCY), 
+ * samples mono são duplicados nos dois canais e a frequência é ajustada por interpolação linear.
+ * 
+ * @param source Ponteiro para o MixerSource a ser preenchido.
+ * @param pcm Buffer de PCM intercalado.
+ * @param frames Quantidade de frames do PCM.
+ * @param channels Quantidade de canais do PCM (1 ou 2).
+ * @param format Formato do PCM.
+ * @param frequency Frequência do PCM.
+ * 
+ * @return Bool indicando se o sample pôde ser convertido.
+ */
+bool create_mixer_source(MixerSource *source, const void *pcm, unsigned int frames, 
+        unsigned int channels, MixerPcmFormat format, unsigned int frequency) {
+    if (frames == 0 || frequency == 0 || channels < 1 || channels > 2) return false;
+
+    double step = (double) frequency / SFX_MIXER_FREQUENCY;
+    unsigned int out_frames = (unsigned int) ((frames - 1) / step) + 1;
+
+    source->data = (float *) malloc(sizeof(float) * SFX_MIXER_CHANNELS * out_frames);
+
+    if (!source->data) {
+        fprintf(stderr, "Failed to create mixer source.\n");
+        exit(-1);
+    }
+
+    for (unsigned int i = 0; i < out_frames; i++) {
+        double position = i * step;
+        unsigned int frame = (unsigned int) position;
+        unsigned int next = frame + 1 < frames ? frame + 1 : frame;
+        float weight = (float) (position - frame);
+
+        for (int c = 0; c < SFX_MIXER_CHANNELS; c++) {
+            unsigned int channel = channels == 1 ? 0 : c;
+            float a = read_pcm_sample(pcm, frame * channels + channel, format);
+            float b = read_pcm_sample(pcm, next * channels + channel, format);
+
+            source->data[i * SFX_MIXER_CHANNELS + c] = a + (b - a) * weight;
+        }
+    }
+
+    source->frames = out_frames;
+
+    return true;
+}
+
+/**
+ * @brief Libera os dados de um MixerSource.
+ * 
+ * @param source Ponteiro para MixerSource.
+ */
+void destroy_mixer_source(MixerSource *source) {
+    free(source->data);
+    source->data = NULL;
+    source->frames = 0;
+}
+
+/**
+ * @brief Inicializa o mixer sem nenhuma voz ativa.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ */
+void init_sfx_mixer(SfxMixer *mixer) {
+    memset(mixer, 0, sizeof(SfxMixer));
+}
+
+/**
+ * @brief Escolhe a voz para um novo som: uma voz livre ou, com o mixer cheio, a voz mais antiga de 
+ * menor prioridade, desde que sua prioridade não seja maior que a do novo som.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * @param priority Prioridade do novo som.
+ * 
+ * @return Ponteiro para MixerVoice ou NULL se nenhuma voz pode ser usada.
+ */
+MixerVoice *get_mixer_voice(SfxMixer *mixer, int priority) {
+    MixerVoice *victim = NULL;
+
+    for (int i = 0; i < SFX_MIXER_VOICES; i++) {
+        MixerVoice *voice = &mixer->voices[i];
+
+        if (!voice->active) return voice;
+
+        if (voice->priority > priority) continue;
+
+        if (!victim || voice->priority < victim->priority ||
+            (voice->priority == victim->priority && voice->started < victim->started))
+            victim = voice;
+    }
+
+    return victim;
+}
+
+/**
+ * @brief Inicia a reprodução de um MixerSource.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * @param source Ponteiro para o MixerSource.
+ * @param gain Ganho da voz.
+ * @param pan Pan da voz, de -1 (esquerda) a 1 (direita), com potência constante.
+ * @param priority Prioridade do som, usada para roubar vozes com o mixer cheio.
+ * 
+ * @return Bool indicando se a voz foi iniciada.
+ */
+bool play_mixer_voice(SfxMixer *mixer, const MixerSource *source, float gain, float pan, int priority) {
+    MixerVoice *voice = get_mixer_voice(mixer, priority);
+
+    if (!voice || !source->data) return false;
+
+    float angle = (pan + 1) * (float) M_PI / 4;
+
+    voice->source = source;
+    voice->position = 0;
+    voice->gain_left = gain * cosf(angle);
+    voice->gain_right = gain * sinf(angle);
+    voice->priority = priority;
+    voice->started = mixer->started++;
+    voice->active = true;
+
+    return true;
+}
+
+/**
+ * @brief Para todas as vozes que reproduzem um MixerSource.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * @param source Ponteiro para o MixerSource.
+ */
+void stop_mixer_source(SfxMixer *mixer, const MixerSource *source) {
+    for (int i = 0; i < SFX_MIXER_VOICES; i++) {
+        if (mixer->voices[i].source == source) mixer->voices[i].active = false;
+    }
+}
+
+/**
+ * @brief Volta para o início todas as vozes que reproduzem um MixerSource.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * @param source Ponteiro para o MixerSource.
+ */
+void rewind_mixer_source(SfxMixer *mixer, const MixerSource *source) {
+    for (int i = 0; i < SFX_MIXER_VOICES; i++) {
+        if (mixer->voices[i].source == source) mixer->voices[i].position = 0;
+    }
+}
+
+/**
+ * @brief Conta as vozes ativas do mixer.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * 
+ * @return Quantidade de vozes ativas.
+ */
+int get_active_mixer_voices(const SfxMixer *mixer) {
+    int active = 0;
+
+    for (int i = 0; i < SFX_MIXER_VOICES; i++)
+        active += mixer->voices[i].active;
+
+    return active;
+}
+
+/**
+ * @brief Soma um trecho estéreo ao buffer de saída aplicando o ganho de cada canal: 
+ * out[l, r] += in[l, r] * [gain_left, gain_right].
+ * 
+ * @param out Buffer de saída estéreo intercalado.
+ * @param in Buffer de entrada estéreo intercalado.
+ * @param frames Quantidade de frames.
+ * @param gain_left Ganho do canal esquerdo.
+ * @param gain_right Ganho do canal direito.
+ */
+void mix_voice_stereo(float *out, const float *in, unsigned int frames, float gain_left, float gain_right) {
+    unsigned int count = frames * SFX_MIXER_CHANNELS;
+    unsigned int i = 0;
+
+#if defined(__AVX__)
+    __m256 gains8 = _mm256_setr_ps(gain_left, gain_right, gain_left, gain_right,
+        gain_left, gain_right, gain_left, gain_right);
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 mixed = _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(_mm256_loadu_ps(in + i), gains8));
+        _mm256_storeu_ps(out + i, mixed);
+    }
+#endif
+
+#if defined(__SSE__)
+    __m128 gains4 = _mm_setr_ps(gain_left, gain_right, gain_left, gain_right);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 mixed = _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), gains4));
+        _mm_storeu_ps(out + i, mixed);
+    }
+#endif
+
+    for (; i < count; i += 2) {
+        out[i] += in[i] * gain_left;
+        out[i + 1] += in[i + 1] * gain_right;
+    }
+}
+
+/**
+ * @brief Limita o buffer de saída entre -1 e 1.
+ * 
+ * @param out Buffer de saída estéreo intercalado.
+ * @param frames Quantidade de frames.
+ */
+void clamp_mixer_output(float *out, unsigned int frames) {
+    unsigned int count = frames * SFX_MIXER_CHANNELS;
+    unsigned int i = 0;
+
+#if defined(__AVX__)
+    __m256 low8 = _mm256_set1_ps(-1.0f), high8 = _mm256_set1_ps(1.0f);
+
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(out + i), low8), high8));
+#endif
+
+#if defined(__SSE__)
+    __m128 low4 = _mm_set1_ps(-1.0f), high4 = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(out + i), low4), high4));
+#endif
+
+    for (; i < count; i++)
+        out[i] = out[i] < -1.0f ? -1.0f : (out[i] > 1.0f ? 1.0f : out[i]);
+}
+
+/**
+ * @brief Gera um trecho da saída do mixer, somando todas as vozes ativas. Vozes que chegam ao 
+ * fim do sample são liberadas.
+ * 
+ * @param mixer Ponteiro para SfxMixer.
+ * @param out Buffer de saída estéreo intercalado com espaço para frames frames.
+ * @param frames Quantidade de frames a gerar.
+ */
+void render_sfx_mixer(SfxMixer *mixer, float *out, unsigned int frames) {
+    memset(out, 0, sizeof(float) * SFX_MIXER_CHANNELS * frames);
+
+    for (int i = 0; i < SFX_MIXER_VOICES; i++) {
+        MixerVoice *voice = &mixer->voices[i];
+        if (!voice->active) continue;
+
+        unsigned int remaining = voice->source->frames - voice->position;
+        unsigned int count = remaining < frames ? remaining : frames;
+
+        mix_voice_stereo(out, voice->source->data + voice->position * SFX_MIXER_CHANNELS, count,
+            voice->gain_left, voice->gain_right);
+
+        voice->position += count;
+        if (voice->position >= voice->source->frames) voice->active = false;
+    }
+
+    clamp_mixer_output(out, frames);
+}
+
+/**
+ * @brief Retorna o nome do kernel de mixagem escolhido na compilação.
+ * 
+ * @return "avx", "sse" ou "scalar".
+ */
+const char *get_sfx_mixer_kernel() {
+#if defined(__AVX__)
+    return "avx";
+#elif defined(__SSE__)
+    return "sse";
+#else
+    return "scalar";
+#endif
+}
@@ -1,9 +1,12 @@
 #include "sound_manager.h"
+#include "audio_queue.h"
+#include "perf_log.h"
 #include <allegro5/allegro_acodec.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #define PLAYER_BULLET_SFX "../assets/sounds/laser_gun.wav"
 #define PLAYER_DIE_SFX "../assets/sounds/player_die.wav"
@@ -25,91 +28,332 @@
 #define MUSIC_BUFFERS 4
 #define MUSIC_BUFFERS_SIZE 2048
 #define RESERVE_SAMPLES 16
+#define AUDIO_THREAD_SLEEP .002
+
+#define PRIORITY_LOW 10
+#define PRIORITY_NORMAL 50
+#define PRIORITY_HIGH 80
+#define PRIORITY_CRITICAL 100
 
 // TODO
 // Refatorar completamente o sound manager
 // Foco em funções sensíveis como rewind e remove
-// Falta de consistência SoundID usado tanto para musics e sfxs
-// Switch case muito grande pode ser simplificado usado arrays
+
+/**
+ * @brief Tabela de assets de som indexada por SoundID, todo som do game é carregado e liberado a 
+ * partir dela.
+ */
+static const SoundAsset sound_assets[SOUND_COUNT] = {
+    [SFX_PLAYER_SHOOT] = {SOUND_SFX, PLAYER_BULLET_SFX, PRIORITY_NORMAL, SFX_GAIN, 2},
+    [SFX_ALIEN_SHOOT] = {SOUND_SFX, ALIEN_BULLET_SFX, PRIORITY_LOW, SFX_GAIN, 2},
+    [SFX_ALIEN_DIE] = {SOUND_SFX, ALIEN_DIE_SFX, PRIORITY_NORMAL, SFX_GAIN, 3},
+    [SFX_PLAYER_HIT] = {SOUND_SFX, PLAYER_HIT_SFX, PRIORITY_HIGH, SFX_GAIN, 1},
+    [PLAYING_BG_MUSIC] = {SOUND_MUSIC, BG_MUSIC, 0, MUSIC_GAIN, 0},
+    [TITLE_SCREEN] = {SOUND_MUSIC, TITLE_SCREEN_MUSIC, 0, MUSIC_GAIN, 0},
+    [SFX_GAME_WIN] = {SOUND_SFX, GAME_WIN_SFX, PRIORITY_CRITICAL, SFX_GAIN, 1},
+    [SFX_HIT_UFO] = {SOUND_SFX, HIT_UFO_SFX, PRIORITY_HIGH, SFX_GAIN, 1},
+    [SFX_UFO] = {SOUND_SFX, UFO_TAKE_OFF_SFX, PRIORITY_NORMAL, SFX_GAIN, 1},
+    [CALM_MUSIC] = {SOUND_MUSIC, CALM_MUIC, 0, MUSIC_GAIN, 0},
+    [SFX_GAME_OVER] = {SOUND_SFX, GAME_OVER_SFX, PRIORITY_CRITICAL, SFX_GAIN, 1},
+};
 
 static SoundBank sb;
+static bool pending_sounds[SOUND_COUNT];
+static double pending_since[SOUND_COUNT];
+static unsigned int available_fragments[SOUND_COUNT];
+static double last_refill[SOUND_COUNT];
+static AudioStats stats;
+static ALLEGRO_MUTEX *stats_mutex = NULL;
+static AudioQueue audio_queue;
+static ALLEGRO_THREAD *audio_thread = NULL;
+static int play_counts[SOUND_COUNT];
+static double pending_fade_time = 0;
+static MusicMode music_mode = MUSIC_STREAMED;
+static bool software_mixer = false;
+static SfxMixer sfx_mixer;
+static ALLEGRO_AUDIO_STREAM *mixer_stream = NULL;
+
+#ifdef NULL_AUDIO_BACKEND
+static bool null_backend = true;
+#else
+static bool null_backend = false;
+#endif
+
+/**
+ * @brief Faz o sound manager usar o backend nulo: todas as chamadas são aceitas e contadas, mas 
+ * nenhum som é carregado ou reproduzido. Deve ser chamada antes de init_sound_manager.
+ */
+void use_null_audio_backend() {
+    null_backend = true;
+}
 
 /**
- * @brief Inicializa os componentes necessários da biblioteca allegro para o sistema de som.
+ * @brief Define como as músicas são carregadas. Deve ser chamada antes de load_sounds.
  * 
- * @return Bool indicando se todos os componentes foram inicializados corretamente.
+ * @param mode Um MusicMode.
+ */
+void set_music_mode(MusicMode mode) {
+    music_mode = mode;
+}
+
+/**
+ * @brief Faz os efeitos sonoros serem mixados pelo SfxMixer em uma única stream, em vez de uma 
+ * voz do allegro por som. Deve ser chamada antes de load_sounds.
+ */
+void use_software_sfx_mixer() {
+    software_mixer = true;
+}
+
+/**
+ * @brief Verifica se o sound manager está usando o backend nulo.
+ * 
+ * @return Bool indicando se o backend nulo está ativo.
+ */
+bool is_null_audio_backend() {
+    return null_backend;
+}
+
+/**
+ * @brief Troca para o backend nulo após uma falha ao inicializar o áudio.
+ * 
+ * @param message Mensagem de erro.
+ * 
+ * @return True, o game continua sem som.
+ */
+bool fall_back_to_null_audio(const char *message) {
+    fprintf(stderr, "%s Audio disabled.\n", message);
+
+    if (al_is_audio_installed()) al_uninstall_audio();
+    null_backend = true;
+
+    return true;
+}
+
+/**
+ * @brief Inicializa os componentes necessários da biblioteca allegro para o sistema de som, se não 
+ * houver dispositivo de áudio o backend nulo é usado.
+ * 
+ * @return Bool indicando se o sistema de som foi inicializado.
  */
 bool init_sound_manager() {
-    if (!al_install_audio()) {
-        fprintf(stderr, "Failed to install audio.\n");
-        return false;
+    if (null_backend) return true;
+
+    if (!al_install_audio())
+        return fall_back_to_null_audio("Failed to install audio.");
+
+    if (!al_init_acodec_addon())
+        return fall_back_to_null_audio("Failed to init acodec addon.");
+
+    if (!al_reserve_samples(RESERVE_SAMPLES))
+        return fall_back_to_null_audio("Failed to reserve samples.");
+
+    return true;
+}
+
+/**
+ * @brief Cria as vozes de um sound effect e as conecta ao mixer padrão.
+ * 
+ * @param sfx_wrapper Ponteiro para SFX.
+ */
+void create_sfx_voices(SFX *sfx_wrapper) {
+    for (int i = 0; i < SFX_VOICES; i++) {
+        ALLEGRO_SAMPLE_INSTANCE *voice = al_create_sample_instance(sfx_wrapper->sfx);
+
+        if (!voice || !al_attach_sample_instance_to_mixer(voice, al_get_default_mixer())) {
+            fprintf(stderr, "Unable to create voice for sample in path %s.\n", sfx_wrapper->path);
+            exit(-1);
+        }
+
+        al_set_sample_instance_gain(voice, sfx_wrapper->gain);
+        al_set_sample_instance_playmode(voice, ALLEGRO_PLAYMODE_ONCE);
+        sfx_wrapper->voices[i] = voice;
     }
 
-    if (!al_init_acodec_addon()) {
-        fprintf(stderr, "Failed to init acodec addon.\n");
-        return false;
+    sfx_wrapper->next_voice = 0;
+}
+
+/**
+ * @brief Converte o sample de um efeito sonoro para o formato do SfxMixer.
+ * 
+ * @param sfx_wrapper Ponteiro para SFX.
+ */
+void create_sfx_mixer_source(SFX *sfx_wrapper) {
+    ALLEGRO_SAMPLE *sample = sfx_wrapper->sfx;
+    MixerPcmFormat format;
+
+    switch (al_get_sample_depth(sample)) {
+        case ALLEGRO_AUDIO_DEPTH_INT8:
+            format = MIXER_PCM_INT8;
+            break;
+        case ALLEGRO_AUDIO_DEPTH_UINT8:
+            format = MIXER_PCM_UINT8;
+            break;
+        case ALLEGRO_AUDIO_DEPTH_INT16:
+            format = MIXER_PCM_INT16;
+            break;
+        case ALLEGRO_AUDIO_DEPTH_FLOAT32:
+            format = MIXER_PCM_FLOAT32;
+            break;
+        default:
+            fprintf(stderr, "Unsupported sample format for the sfx mixer in path %s.\n", sfx_wrapper->path);
+            exit(-1);
     }
 
+    if (!create_mixer_source(&sfx_wrapper->mixed, al_get_sample_data(sample), al_get_sample_length(sample),
+            al_get_channel_count(al_get_sample_channels(sample)), format, al_get_sample_frequency(sample))) {
+        fprintf(stderr, "Unable to convert sample in path %s for the sfx mixer.\n", sfx_wrapper->path);
+        exit(-1);
+    }
+}
 
-    if (!al_reserve_samples(RESERVE_SAMPLES)) {
-        fprintf(stderr, "Failed to reserve samples.\n");
-        return false;
+/**
+ * @brief Cria a stream que recebe a saída do SfxMixer.
+ */
+void create_sfx_mixer_stream() {
+    mixer_stream = al_create_audio_stream(SFX_MIXER_BUFFERS, SFX_MIXER_FRAGMENT_FRAMES,
+        SFX_MIXER_FREQUENCY, ALLEGRO_AUDIO_DEPTH_FLOAT32, ALLEGRO_CHANNEL_CONF_2);
+
+    if (!mixer_stream || !al_attach_audio_stream_to_mixer(mixer_stream, al_get_default_mixer())) {
+        fprintf(stderr, "Failed to create sfx mixer stream.\n");
+        exit(-1);
     }
 
-    return true;
+    init_sfx_mixer(&sfx_mixer);
+}
+
+/**
+ * @brief Preenche os fragmentos livres da stream do mixer, chamada somente pelo audio thread.
+ */
+void fill_sfx_mixer_stream() {
+    float *fragment;
+
+    if (!mixer_stream) return;
+
+    while ((fragment = (float *) al_get_audio_stream_fragment(mixer_stream))) {
+        render_sfx_mixer(&sfx_mixer, fragment, SFX_MIXER_FRAGMENT_FRAMES);
+        al_set_audio_stream_fragment(mixer_stream, fragment);
+    }
 }
 
 /**
- * @brief Carrega um sound effect.
+ * @brief Carrega um sound effect e cria suas vozes.
  * 
- * @param sample_path Caminho para o sound effect.
+ * @param asset Entrada da tabela de assets. A prioridade permite roubar vozes de efeitos de menor 
+ * prioridade e max_voices limita as vozes usadas ao mesmo tempo (até SFX_VOICES).
  * 
  * @return Ponteiro para SFX. 
  */
-SFX* load_sound(char *sample_path) {
-    SFX *sfx_wrapper = (SFX *) malloc(sizeof(SFX));
+SFX* load_sound(const SoundAsset *asset) {
+    SFX *sfx_wrapper = (SFX *) calloc(1, sizeof(SFX));
 
     if (!sfx_wrapper) {
         fprintf(stderr, "Failed to create sfx wrapper.\n");
         exit(-1);
     }
 
-    sfx_wrapper->sfx = al_load_sample(sample_path);
+    sfx_wrapper->sfx = al_load_sample(asset->path);
 
     if (!sfx_wrapper->sfx) {
-        fprintf(stderr, "Unable to load sample in path %s.\n", sample_path);
+        fprintf(stderr, "Unable to load sample in path %s.\n", asset->path);
         exit(-1);
     }
 
-    strcpy(sfx_wrapper->path, sample_path);
+    strcpy(sfx_wrapper->path, asset->path);
+    sfx_wrapper->priority = asset->priority;
+    sfx_wrapper->gain = asset->gain;
+    sfx_wrapper->max_voices = asset->max_voices < SFX_VOICES ? asset->max_voices : SFX_VOICES;
+
+    if (software_mixer)
+        create_sfx_mixer_source(sfx_wrapper);
+    else
+        create_sfx_voices(sfx_wrapper);
 
     return sfx_wrapper;
 }
 
 /**
- * @brief Carrega um música.
+ * @brief Carrega uma música como stream, decodificada aos poucos durante a reprodução.
+ * 
+ * @param music_wrapper Ponteiro para Music.
+ * @param music_path Caminho para uma música.
+ * 
+ * @return Bool indicando se a stream foi criada e conectada ao mixer.
+ */
+bool load_streamed_music(Music *music_wrapper, const char *music_path) {
+    music_wrapper->music = al_load_audio_stream(
+        music_path, MUSIC_BUFFERS, MUSIC_BUFFERS_SIZE);
+
+    if (!music_wrapper->music || 
+        !al_attach_audio_stream_to_mixer(music_wrapper->music, al_get_default_mixer()))
+        return false;
+
+    al_set_audio_stream_playing(music_wrapper->music, false);
+    al_set_audio_stream_playmode(music_wrapper->music, ALLEGRO_PLAYMODE_LOOP);
+    al_set_audio_stream_gain(music_wrapper->music, 0);
+
+    return true;
+}
+
+/**
+ * @brief Carrega uma música inteira já decodificada, direto do arquivo ou do cache PCM, e cria a 
+ * instância que a reproduz da memória.
  * 
+ * @param music_wrapper Ponteiro para Music.
  * @param music_path Caminho para uma música.
  * 
+ * @return Bool indicando se a música foi decodificada e conectada ao mixer.
+ */
+bool load_decoded_music(Music *music_wrapper, const char *music_path) {
+    if (music_mode == MUSIC_PCM_CACHE) {
+        music_wrapper->decoded = load_cached_music(music_path);
+    } else {
+        music_wrapper->decoded.sample = al_load_sample(music_path);
+    }
+
+    if (!music_wrapper->decoded.sample) return false;
+
+    music_wrapper->instance = al_create_sample_instance(music_wrapper->decoded.sample);
+
+    if (!music_wrapper->instance ||
+        !al_attach_sample_instance_to_mixer(music_wrapper->instance, al_get_default_mixer()))
+        return false;
+
+    al_set_sample_instance_playmode(music_wrapper->instance, ALLEGRO_PLAYMODE_LOOP);
+    al_set_sample_instance_gain(music_wrapper->instance, 0);
+
+    return true;
+}
+
+/**
+ * @brief Carrega um música de acordo com o MusicMode atual.
+ * 
+ * @param asset Entrada da tabela de assets.
+ * 
  * @return Ponteiro para Music. 
  */
-Music* load_music(char *music_path) {
-    Music *music_wrapper = (Music *) malloc(sizeof(Music));
+Music* load_music(const SoundAsset *asset) {
+    const char *music_path = asset->path;
+    Music *music_wrapper = (Music *) calloc(1, sizeof(Music));
 
     if (!music_wrapper) {
         fprintf(stderr, "Failed to create music wrapper.\n");
         exit(-1);
     } 
 
-    music_wrapper->music = al_load_audio_stream(
-        music_path, MUSIC_BUFFERS, MUSIC_BUFFERS_SIZE);
+    bool loaded = music_mode == MUSIC_STREAMED ?
+        load_streamed_music(music_wrapper, music_path) :
+        load_decoded_music(music_wrapper, music_path);
 
-    if (!music_wrapper->music) {
+    if (!loaded) {
         fprintf(stderr, "Unable to load music in path %s.\n", music_path);
         exit(-1);
     }
 
     strcpy(music_wrapper->path, music_path);
+    music_wrapper->volume = asset->gain;
+    music_wrapper->gain = 0;
+    music_wrapper->target_gain = 0;
+    music_wrapper->fade_speed = 0;
 
     return music_wrapper;
 }
@@ -118,17 +362,27 @@ Music* load_music(char *music_path) {
  * @brief Carrega todas os sons e músicas utilizados no game.
  */
 void load_sounds() {
-    sb.player_shoot = load_sound(PLAYER_BULLET_SFX);
-    sb.alien_shoot = load_sound(ALIEN_BULLET_SFX);
-    sb.alien_die = load_sound(ALIEN_DIE_SFX);
-    sb.player_hit = load_sound(PLAYER_HIT_SFX);
-    sb.ufo_take_off = load_sound(UFO_TAKE_OFF_SFX);
-    sb.game_win = load_sound(GAME_WIN_SFX);
-    sb.hit_ufo = load_sound(HIT_UFO_SFX);
-    sb.game_over = load_sound(GAME_OVER_SFX);
-    sb.calm_music = load_music(CALM_MUIC);
-    sb.playing_bg = load_music(BG_MUSIC);
-    sb.title_screen = load_music(TITLE_SCREEN_MUSIC);
+    if (null_backend) return;
+
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        const SoundAsset *asset = &sound_assets[id];
+
+        if (!asset->path) {
+            fprintf(stderr, "Missing sound asset for SoundID %d.\n", id);
+            exit(-1);
+        }
+
+        if (asset->kind == SOUND_SFX)
+            sb.sfx[id] = load_sound(asset);
+        else
+            sb.music[id] = load_music(asset);
+    }
+
+    if (software_mixer)
+        create_sfx_mixer_stream();
+
+    init_audio_queue(&audio_queue);
+    start_audio_thread();
 }
 
 /**
@@ -139,26 +393,9 @@ void load_sounds() {
  * @return Ponteiro para SFX desejado.
  */
 SFX* get_sfx(SoundID id) {
-    switch(id) {
-        case SFX_PLAYER_SHOOT:
-            return sb.player_shoot;
-        case SFX_PLAYER_HIT:
-            return sb.player_hit;
-        case SFX_ALIEN_SHOOT:
-            return sb.alien_shoot;
-        case    SFX_ALIEN_DIE:
-            return sb.alien_die;
-        case SFX_UFO:
-            return sb.ufo_take_off;
-        case SFX_GAME_WIN:
-            return sb.game_win;
-        case SFX_HIT_UFO:
-            return sb.hit_ufo;
-        case SFX_GAME_OVER:
-            return sb.game_over;
-        default:
-            return NULL;
-    }
+    if (id < 0 || id >= SOUND_COUNT) return NULL;
+
+    return sb.sfx[id];
 }
 
 /**
@@ -169,39 +406,314 @@ SFX* get_sfx(SoundID id) {
  * @return Ponteiro para Music desejada..
  */
 Music* get_music(SoundID id) {
-    switch(id) {
-        case PLAYING_BG_MUSIC:
-            return sb.playing_bg;
-        case TITLE_SCREEN:
-            return sb.title_screen;
-        case CALM_MUSIC:
-            return sb.calm_music;
-        default:
-            return NULL;
+    if (id < 0 || id >= SOUND_COUNT) return NULL;
+
+    return sb.music[id];
+}
+
+/**
+ * @brief Retorna uma voz livre do efeito sonoro, se todas as vozes permitidas estiverem tocando 
+ * a mais antiga é reutilizada.
+ * 
+ * @param sfx_wrapper Ponteiro para SFX.
+ * @param is_free Ponteiro para um bool que indica se a voz retornada estava livre.
+ * 
+ * @return Ponteiro para ALLEGRO_SAMPLE_INSTANCE.
+ */
+ALLEGRO_SAMPLE_INSTANCE *get_free_voice(SFX *sfx_wrapper, bool *is_free) {
+    int max_voices = sfx_wrapper->max_voices;
+
+    for (int i = 0; i < max_voices; i++) {
+        int index = (sfx_wrapper->next_voice + i) % max_voices;
+
+        if (!al_get_sample_instance_playing(sfx_wrapper->voices[index])) {
+            sfx_wrapper->next_voice = (index + 1) % max_voices;
+            *is_free = true;
+            return sfx_wrapper->voices[index];
+        }
+    }
+
+    ALLEGRO_SAMPLE_INSTANCE *oldest = sfx_wrapper->voices[sfx_wrapper->next_voice];
+    sfx_wrapper->next_voice = (sfx_wrapper->next_voice + 1) % max_voices;
+    *is_free = false;
+
+    return oldest;
+}
+
+/**
+ * @brief Conta quantas vozes de efeitos sonoros estão tocando.
+ * 
+ * @return Quantidade de vozes ativas.
+ */
+int get_active_sfx_voices() {
+    int active = 0;
+
+    if (software_mixer) return get_active_mixer_voices(&sfx_mixer);
+
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        SFX *sfx_wrapper = get_sfx(id);
+        if (!sfx_wrapper) continue;
+
+        for (int i = 0; i < sfx_wrapper->max_voices; i++)
+            active += al_get_sample_instance_playing(sfx_wrapper->voices[i]);
     }
+
+    return active;
+}
+
+/**
+ * @brief Para uma voz de um efeito com prioridade menor que a desejada, liberando espaço no 
+ * orçamento de vozes. A voz roubada é sempre a do efeito de menor prioridade.
+ * 
+ * @param priority Prioridade do efeito que precisa de uma voz.
+ * 
+ * @return Bool indicando se alguma voz foi liberada.
+ */
+bool steal_voice(int priority) {
+    ALLEGRO_SAMPLE_INSTANCE *victim = NULL;
+    int victim_priority = priority;
+
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        SFX *sfx_wrapper = get_sfx(id);
+        if (!sfx_wrapper || sfx_wrapper->priority >= victim_priority) continue;
+
+        for (int i = 0; i < sfx_wrapper->max_voices; i++) {
+            if (al_get_sample_instance_playing(sfx_wrapper->voices[i])) {
+                victim = sfx_wrapper->voices[i];
+                victim_priority = sfx_wrapper->priority;
+                break;
+            }
+        }
+    }
+
+    if (!victim) return false;
+
+    al_stop_sample_instance(victim);
+
+    return true;
+}
+
+/**
+ * @brief Toca um efeito sonoro respeitando seu limite de vozes e o orçamento global de vozes,
+ * se não houver voz disponível uma voz de menor prioridade é roubada ou o som é descartado.
+ * 
+ * @param sfx_wrapper Ponteiro para SFX.
+ */
+bool start_sound(SFX *sfx_wrapper) {
+    if (software_mixer)
+        return play_mixer_voice(&sfx_mixer, &sfx_wrapper->mixed, sfx_wrapper->gain, 0, sfx_wrapper->priority);
+
+    bool is_free;
+    ALLEGRO_SAMPLE_INSTANCE *voice = get_free_voice(sfx_wrapper, &is_free);
+
+    if (is_free && get_active_sfx_voices() >= SFX_VOICE_BUDGET && 
+        !steal_voice(sfx_wrapper->priority))
+        return false;
+
+    al_set_sample_instance_position(voice, 0);
+    return al_play_sample_instance(voice);
+}
+
+/**
+ * @brief Registra a latência de um efeito sonoro, do pedido até o início da reprodução.
+ * 
+ * @param latency Latência em segundos.
+ */
+void record_sound_latency(double latency) {
+    al_lock_mutex(stats_mutex);
+    stats.sounds_started++;
+    stats.total_start_latency += latency;
+    if (latency > stats.max_start_latency) stats.max_start_latency = latency;
+    al_unlock_mutex(stats_mutex);
 }
 
 /**
- * @brief Utiliza al_play_sample para tocar um efeito sonoro.
+ * @brief Agenda um efeito sonoro para o fim do tick, pedidos repetidos do mesmo efeito no 
+ * mesmo tick são unidos em um só.
  * 
  * @param id Um SoundID para o efeito sonoro desejado.
+ * @param timestamp Momento em que o efeito foi pedido pelo game thread.
  */
-void play_sound(SoundID id) {
-    SFX *sfx_wrapper = get_sfx(id);
-    al_play_sample(sfx_wrapper->sfx, SFX_GAIN, 0, 1.0, 
-        ALLEGRO_PLAYMODE_ONCE, &sfx_wrapper->id);
+void queue_sound(SoundID id, double timestamp) {
+    if (!get_sfx(id)) return;
+
+    if (!pending_sounds[id]) pending_since[id] = timestamp;
+    pending_sounds[id] = true;
+}
+
+/**
+ * @brief Toca os efeitos sonoros agendados no tick, em ordem de prioridade.
+ */
+void start_pending_sounds() {
+    while (true) {
+        int next = -1;
+
+        for (int id = 0; id < SOUND_COUNT; id++) {
+            if (pending_sounds[id] && (next < 0 || get_sfx(id)->priority > get_sfx(next)->priority))
+                next = id;
+        }
+
+        if (next < 0) return;
+
+        pending_sounds[next] = false;
+
+        if (start_sound(get_sfx(next)))
+            record_sound_latency(al_get_time() - pending_since[next]);
+    }
+}
+
+/**
+ * @brief Define o ganho atual de uma música.
+ * 
+ * @param music_wrapper Ponteiro para Music.
+ * @param gain Novo ganho.
+ */
+void set_music_gain(Music *music_wrapper, float gain) {
+    music_wrapper->gain = gain;
+
+    if (music_wrapper->instance)
+        al_set_sample_instance_gain(music_wrapper->instance, gain);
+    else
+        al_set_audio_stream_gain(music_wrapper->music, gain);
+}
+
+/**
+ * @brief Pausa ou continua a reprodução de uma música na posição atual.
+ * 
+ * @param music_wrapper Ponteiro para Music.
+ * @param playing Bool indicando se a música deve tocar.
+ */
+void set_music_playing(Music *music_wrapper, bool playing) {
+    if (music_wrapper->instance)
+        al_set_sample_instance_playing(music_wrapper->instance, playing);
+    else
+        al_set_audio_stream_playing(music_wrapper->music, playing);
+}
+
+/**
+ * @brief Volta uma música para o início.
+ * 
+ * @param music_wrapper Ponteiro para Music.
+ */
+void seek_music(Music *music_wrapper) {
+    if (music_wrapper->instance)
+        al_set_sample_instance_position(music_wrapper->instance, 0);
+    else
+        al_rewind_audio_stream(music_wrapper->music);
+}
+
+/**
+ * @brief Para a repodução de uma música.
+ * 
+ * @param id Um SoundID para a música desejada. 
+ */
+void stop_music(SoundID id) {
+    Music *music_wrapper = get_music(id);
+
+    music_wrapper->target_gain = 0;
+    set_music_gain(music_wrapper, 0);
+    set_music_playing(music_wrapper, false);
 }
 
 /**
- * @brief Utiliza algumas funções da biblioteca allegro para colocar música no mixer e reproduzí-la.
+ * @brief Reseta uma música para o início, a stream existente volta para a posição zero sem
+ * reabrir o arquivo.
+ * 
+ * @param id Um SoundID para a música desejada. 
+ */
+void seek_music_start(SoundID id) {
+    seek_music(get_music(id));
+}
+
+/**
+ * @brief Reproduz uma música imediatamente com o ganho padrão.
  * 
  * @param id Um SoundID para a música desejada.
  */
-void play_music(SoundID id) {
+void start_music(SoundID id) {
     Music *music_wrapper = get_music(id);
-    al_attach_audio_stream_to_mixer(music_wrapper->music, al_get_default_mixer());
-    al_set_audio_stream_playmode(music_wrapper->music, ALLEGRO_PLAYMODE_LOOP);
-    al_set_audio_stream_gain(music_wrapper->music, MUSIC_GAIN);
+
+    music_wrapper->target_gain = music_wrapper->volume;
+    music_wrapper->fade_speed = 0;
+    set_music_gain(music_wrapper, music_wrapper->volume);
+    set_music_playing(music_wrapper, true);
+}
+
+/**
+ * @brief Inicia uma música com volume zero e aumenta seu volume até o ganho padrão. Se a música 
+ * ainda estava saindo (fade out) ela é reiniciada do começo.
+ * 
+ * @param id Um SoundID para a música desejada.
+ * @param seconds Duração do fade em segundos.
+ */
+void start_music_fade_in(SoundID id, double seconds) {
+    Music *music_wrapper = get_music(id);
+
+    if (seconds <= 0) {
+        start_music(id);
+        return;
+    }
+
+    if (music_wrapper->target_gain == 0) {
+        seek_music(music_wrapper);
+        set_music_gain(music_wrapper, 0);
+    }
+
+    music_wrapper->target_gain = music_wrapper->volume;
+    music_wrapper->fade_speed = music_wrapper->volume / seconds;
+    set_music_playing(music_wrapper, true);
+}
+
+/**
+ * @brief Diminui o volume de uma música até zero, quando o volume chega a zero a música é
+ * pausada e volta para o início.
+ * 
+ * @param id Um SoundID para a música desejada.
+ * @param seconds Duração do fade em segundos.
+ */
+void start_music_fade_out(SoundID id, double seconds) {
+    Music *music_wrapper = get_music(id);
+
+    if (seconds <= 0 || music_wrapper->gain == 0) {
+        stop_music(id);
+        seek_music_start(id);
+        return;
+    }
+
+    music_wrapper->target_gain = 0;
+    music_wrapper->fade_speed = music_wrapper->gain / seconds;
+}
+
+/**
+ * @brief Avança o fade de uma música.
+ * 
+ * @param music_wrapper Ponteiro para Music.
+ * @param delta_time Tempo em segundos desde a última atualização.
+ */
+void update_music_fade(Music *music_wrapper, double delta_time) {
+    if (!music_wrapper || music_wrapper->gain == music_wrapper->target_gain) return;
+
+    float step = music_wrapper->fade_speed * delta_time;
+    float gain = music_wrapper->gain < music_wrapper->target_gain ?
+        fminf(music_wrapper->gain + step, music_wrapper->target_gain) :
+        fmaxf(music_wrapper->gain - step, music_wrapper->target_gain);
+
+    set_music_gain(music_wrapper, gain);
+
+    if (gain == 0) {
+        set_music_playing(music_wrapper, false);
+        seek_music(music_wrapper);
+    }
+}
+
+/**
+ * @brief Avança os fades de todas as músicas.
+ * 
+ * @param delta_time Tempo em segundos desde a última atualização.
+ */
+void advance_music_fades(double delta_time) {
+    for (int id = 0; id < SOUND_COUNT; id++)
+        update_music_fade(sb.music[id], delta_time);
 }
 
 /**
@@ -227,32 +739,314 @@ void destroy_audio_stream(ALLEGRO_AUDIO_STREAM *music) {
 }
 
 /**
- * @brief Reseta uma música para o início.
+ * @brief Para a repodução de uma efeito sonoro em todas as suas vozes.
  * 
- * @param id Um SoundID para a música desejada. 
+ * @param id Um SoundID para o efeito sonoro desejado. 
  */
-void rewind_music(SoundID id) {
+void stop_sound(SoundID id) {
+    SFX *sfx_wrapper = get_sfx(id);
+
+    pending_sounds[id] = false;
+
+    if (software_mixer) {
+        stop_mixer_source(&sfx_mixer, &sfx_wrapper->mixed);
+        return;
+    }
+
+    for (int i = 0; i < SFX_VOICES; i++)
+        al_stop_sample_instance(sfx_wrapper->voices[i]);
+} 
+
+/**
+ * @brief Reseta um efeito sonoro para o início, as vozes voltam para a posição zero sem 
+ * recarregar o sample.
+ * 
+ * @param id Um SoundID para o efeito sonoro desejado. 
+ */
+void seek_sound_start(SoundID id) {
+    SFX *sfx_wrapper = get_sfx(id);
+
+    if (software_mixer) {
+        rewind_mixer_source(&sfx_mixer, &sfx_wrapper->mixed);
+        return;
+    }
+
+    for (int i = 0; i < SFX_VOICES; i++)
+        al_set_sample_instance_position(sfx_wrapper->voices[i], 0);
+
+    sfx_wrapper->next_voice = 0;
+}
+
+/**
+ * @brief Executa um comando de áudio, chamada somente pelo audio thread.
+ * 
+ * @param command Ponteiro para o comando.
+ */
+void execute_audio_command(const AudioCommand *command) {
+    switch (command->type) {
+        case AUDIO_PLAY_SOUND:
+            queue_sound(command->id, command->timestamp);
+            break;
+        case AUDIO_STOP_SOUND:
+            stop_sound(command->id);
+            break;
+        case AUDIO_REWIND_SOUND:
+            seek_sound_start(command->id);
+            break;
+        case AUDIO_FLUSH_SOUNDS:
+            start_pending_sounds();
+            break;
+        case AUDIO_PLAY_MUSIC:
+            start_music(command->id);
+            break;
+        case AUDIO_STOP_MUSIC:
+            stop_music(command->id);
+            break;
+        case AUDIO_REWIND_MUSIC:
+            seek_music_start(command->id);
+            break;
+        case AUDIO_FADE_IN_MUSIC:
+            start_music_fade_in(command->id, command->value);
+            break;
+        case AUDIO_FADE_OUT_MUSIC:
+            start_music_fade_out(command->id, command->value);
+            break;
+        case AUDIO_UPDATE_FADES:
+            advance_music_fades(command->value);
+            break;
+    }
+}
+
+/**
+ * @brief Executa todos os comandos pendentes na fila.
+ */
+void drain_audio_commands() {
+    AudioCommand command;
+
+    while (pop_audio_command(&audio_queue, &command))
+        execute_audio_command(&command);
+}
+
+/**
+ * @brief Amostra a stream de uma música: conta os fragmentos preenchidos de novo desde a última 
+ * amostra, o intervalo entre refills e os underruns.
+ * 
+ * @param id SoundID da música.
+ * @param now Tempo atual em segundos.
+ */
+void sample_music_stream(SoundID id, double now) {
     Music *music_wrapper = get_music(id);
 
-    destroy_audio_stream(music_wrapper->music);
+    if (!music_wrapper || !music_wrapper->music || !al_get_audio_stream_playing(music_wrapper->music)) {
+        available_fragments[id] = 0;
+        return;
+    }
 
-    music_wrapper->music = al_load_audio_stream(
-        music_wrapper->path, MUSIC_BUFFERS, MUSIC_BUFFERS_SIZE);
+    MusicStreamStats *stream = &stats.streams[id];
+    unsigned int available = al_get_available_audio_stream_fragments(music_wrapper->music);
+    int queued = MUSIC_BUFFERS - (int) available;
+
+    al_lock_mutex(stats_mutex);
+
+    if (available < available_fragments[id]) {
+        if (last_refill[id] > 0) {
+            double interval = now - last_refill[id];
+
+            stream->refill_intervals++;
+            stream->total_refill_interval += interval;
+            if (interval > stream->max_refill_interval) stream->max_refill_interval = interval;
+        }
+
+        stream->refills += available_fragments[id] - available;
+        last_refill[id] = now;
+    }
+
+    if (queued <= 0 && available_fragments[id] < MUSIC_BUFFERS)
+        stream->underruns++;
+
+    if (queued < stream->min_queued_fragments)
+        stream->min_queued_fragments = queued;
+
+    al_unlock_mutex(stats_mutex);
+    available_fragments[id] = available;
+}
+
+/**
+ * @brief Amostra as streams de todas as músicas.
+ */
+void sample_music_streams() {
+    double now = al_get_time();
+
+    for (int id = 0; id < SOUND_COUNT; id++)
+        sample_music_stream(id, now);
+}
+
+/**
+ * @brief Loop do audio thread, consome os comandos enviados pelo game thread, amostra as streams 
+ * das músicas e dorme por um curto intervalo quando a fila está vazia.
+ * 
+ * @param thread Ponteiro para o ALLEGRO_THREAD.
+ * @param arg Argumento não utilizado.
+ * 
+ * @return NULL.
+ */
+void *audio_thread_loop(ALLEGRO_THREAD *thread, void *arg) {
+    while (!al_get_thread_should_stop(thread)) {
+        drain_audio_commands();
+        fill_sfx_mixer_stream();
+        sample_music_streams();
+        al_rest(AUDIO_THREAD_SLEEP);
+    }
+
+    drain_audio_commands();
 
-    if (!music_wrapper->music) {
-        fprintf(stderr, "Failed to load music in path %s.\n", music_wrapper->path);
+    return NULL;
+}
+
+/**
+ * @brief Inicia o audio thread.
+ */
+void start_audio_thread() {
+    stats_mutex = al_create_mutex();
+
+    if (!stats_mutex) {
+        fprintf(stderr, "Failed to create audio stats mutex.\n");
         exit(-1);
     }
+
+    for (int id = 0; id < SOUND_COUNT; id++)
+        stats.streams[id].min_queued_fragments = MUSIC_BUFFERS;
+
+    audio_thread = al_create_thread(audio_thread_loop, NULL);
+
+    if (!audio_thread) {
+        fprintf(stderr, "Failed to create audio thread.\n");
+        exit(-1);
+    }
+
+    al_start_thread(audio_thread);
 }
 
 /**
- * @brief Para a repodução de uma efeito sonoro.
+ * @brief Para o audio thread, os comandos ainda na fila são executados antes dele terminar.
+ */
+void stop_audio_thread() {
+    if (!audio_thread) return;
+
+    al_join_thread(audio_thread, NULL);
+    al_destroy_thread(audio_thread);
+    al_destroy_mutex(stats_mutex);
+    audio_thread = NULL;
+    stats_mutex = NULL;
+}
+
+/**
+ * @brief Envia um comando para o audio thread sem bloquear o game thread.
+ * 
+ * @param type Tipo do comando.
+ * @param id SoundID alvo.
+ * @param value Valor opcional do comando.
+ */
+void send_audio_command(AudioCommandType type, SoundID id, float value) {
+    if (type == AUDIO_PLAY_SOUND || type == AUDIO_PLAY_MUSIC || type == AUDIO_FADE_IN_MUSIC)
+        play_counts[id]++;
+
+    if (null_backend) return;
+
+    AudioCommand command = {.type = type, .id = id, .value = value, .timestamp = al_get_time()};
+    push_audio_command(&audio_queue, command);
+}
+
+/**
+ * @brief Retorna quantas vezes um som ou música foi reproduzido desde o início do programa 
+ * (ou desde a última chamada de reset_sound_play_counts), em qualquer backend.
+ * 
+ * @param id Um SoundID.
+ * 
+ * @return Quantidade de reproduções.
+ */
+int get_sound_play_count(SoundID id) {
+    return play_counts[id];
+}
+
+/**
+ * @brief Retorna uma cópia das estatísticas do sistema de som, zeradas no backend nulo.
+ * 
+ * @return AudioStats.
+ */
+AudioStats get_audio_stats() {
+    AudioStats copy = {0};
+
+    if (!stats_mutex) return copy;
+
+    al_lock_mutex(stats_mutex);
+    copy = stats;
+    al_unlock_mutex(stats_mutex);
+
+    copy.dropped_commands = get_dropped_audio_commands(&audio_queue);
+
+    return copy;
+}
+
+/**
+ * @brief Escreve as estatísticas do sistema de som no log de performance.
+ */
+void write_audio_stats_to_perf_log() {
+    if (!is_perf_log_open() || null_backend) return;
+
+    AudioStats current = get_audio_stats();
+
+    write_perf_log("audio", "sfx_started=%lu latency_mean_ms=%.3f latency_max_ms=%.3f dropped_commands=%u",
+        current.sounds_started,
+        current.sounds_started ? current.total_start_latency / current.sounds_started * 1000 : 0,
+        current.max_start_latency * 1000, current.dropped_commands);
+
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        MusicStreamStats *stream = &current.streams[id];
+
+        if (!get_music(id) || !get_music(id)->music) continue;
+
+        write_perf_log("audio", "stream=%s buffers=%d buffer_size=%d refills=%lu underruns=%lu "
+            "min_queued=%d refill_mean_ms=%.3f refill_max_ms=%.3f",
+            get_music(id)->path, MUSIC_BUFFERS, MUSIC_BUFFERS_SIZE, stream->refills,
+            stream->underruns, stream->min_queued_fragments,
+            stream->refill_intervals ? stream->total_refill_interval / stream->refill_intervals * 1000 : 0,
+            stream->max_refill_interval * 1000);
+    }
+}
+
+/**
+ * @brief Zera os contadores de reprodução.
+ */
+void reset_sound_play_counts() {
+    memset(play_counts, 0, sizeof(play_counts));
+}
+
+/**
+ * @brief Agenda um efeito sonoro, pedidos repetidos do mesmo efeito no mesmo tick são unidos em um só.
+ * 
+ * @param id Um SoundID para o efeito sonoro desejado.
+ */
+void play_sound(SoundID id) {
+    send_audio_command(AUDIO_PLAY_SOUND, id, 0);
+}
+
+/**
+ * @brief Toca os efeitos sonoros agendados no tick, em ordem de prioridade. Deve ser chamada
+ * uma vez por tick.
+ */
+void flush_sound_requests() {
+    send_audio_command(AUDIO_FLUSH_SOUNDS, 0, 0);
+}
+
+/**
+ * @brief Para a repodução de uma efeito sonoro em todas as suas vozes.
  * 
  * @param id Um SoundID para o efeito sonoro desejado. 
  */
 void remove_sound(SoundID id) {
-    al_stop_sample(&get_sfx(id)->id);
-} 
+    send_audio_command(AUDIO_STOP_SOUND, id, 0);
+}
 
 /**
  * @brief Reseta um efeito sonoro para o início.
@@ -260,16 +1054,16 @@ void remove_sound(SoundID id) {
  * @param id Um SoundID para o efeito sonoro desejado. 
  */
 void rewind_sound(SoundID id) {
-    SFX *sfx_wrapper = get_sfx(id);
-
-    destroy_sample(sfx_wrapper->sfx);
-
-    sfx_wrapper->sfx = al_load_sample(sfx_wrapper->path);
+    send_audio_command(AUDIO_REWIND_SOUND, id, 0);
+}
 
-    if (!sfx_wrapper->sfx) {
-        fprintf(stderr, "Failed to load sfx in path %s.\n", sfx_wrapper->path);
-        exit(-1);
-    }
+/**
+ * @brief Reproduz uma música imediatamente com o ganho padrão.
+ * 
+ * @param id Um SoundID para a música desejada.
+ */
+void play_music(SoundID id) {
+    send_audio_command(AUDIO_PLAY_MUSIC, id, 0);
 }
 
 /**
@@ -278,7 +1072,70 @@ void rewind_sound(SoundID id) {
  * @param id Um SoundID para a música desejada. 
  */
 void remove_music(SoundID id) {
-    al_detach_audio_stream(get_music(id)->music);
+    send_audio_command(AUDIO_STOP_MUSIC, id, 0);
+}
+
+/**
+ * @brief Reseta uma música para o início.
+ * 
+ * @param id Um SoundID para a música desejada. 
+ */
+void rewind_music(SoundID id) {
+    send_audio_command(AUDIO_REWIND_MUSIC, id, 0);
+}
+
+/**
+ * @brief Inicia uma música com volume zero e aumenta seu volume até o ganho padrão.
+ * 
+ * @param id Um SoundID para a música desejada.
+ * @param seconds Duração do fade em segundos.
+ */
+void fade_in_music(SoundID id, double seconds) {
+    pending_fade_time = fmax(pending_fade_time, seconds);
+    send_audio_command(AUDIO_FADE_IN_MUSIC, id, seconds);
+}
+
+/**
+ * @brief Diminui o volume de uma música até zero, depois ela é pausada e volta para o início.
+ * 
+ * @param id Um SoundID para a música desejada.
+ * @param seconds Duração do fade em segundos.
+ */
+void fade_out_music(SoundID id, double seconds) {
+    pending_fade_time = fmax(pending_fade_time, seconds);
+    send_audio_command(AUDIO_FADE_OUT_MUSIC, id, seconds);
+}
+
+/**
+ * @brief Faz a transição entre duas músicas, uma sai enquanto a outra entra.
+ * 
+ * @param from Um SoundID para a música que está tocando.
+ * @param to Um SoundID para a próxima música.
+ * @param seconds Duração da transição em segundos.
+ */
+void crossfade_music(SoundID from, SoundID to, double seconds) {
+    fade_out_music(from, seconds);
+    fade_in_music(to, seconds);
+}
+
+/**
+ * @brief Avança os fades de todas as músicas, deve ser chamada a cada tick.
+ * 
+ * @param delta_time Tempo em segundos desde a última atualização.
+ */
+void update_music_fades(double delta_time) {
+    pending_fade_time = fmax(pending_fade_time - delta_time, 0);
+    send_audio_command(AUDIO_UPDATE_FADES, 0, delta_time);
+}
+
+/**
+ * @brief Verifica se algum fade ainda precisa de ticks para terminar. O tempo é contado na thread 
+ * principal, assim não é preciso consultar o audio thread.
+ * 
+ * @return Bool indicando se há fades em andamento.
+ */
+bool has_pending_music_fades() {
+    return pending_fade_time > 0;
 }
 
 /**
@@ -289,6 +1146,11 @@ void remove_music(SoundID id) {
 void destroy_sfx_wrapper(SFX *sfx_wrapper) {
     if (!sfx_wrapper) return;
 
+    for (int i = 0; i < SFX_VOICES; i++) {
+        if (sfx_wrapper->voices[i]) al_destroy_sample_instance(sfx_wrapper->voices[i]);
+    }
+
+    destroy_mixer_source(&sfx_wrapper->mixed);
     destroy_sample(sfx_wrapper->sfx);
     free(sfx_wrapper);
 }
@@ -301,6 +1163,8 @@ void destroy_sfx_wrapper(SFX *sfx_wrapper) {
 void destroy_music_wrapper(Music *music_wrapper) {
     if (!music_wrapper) return;
 
+    if (music_wrapper->instance) al_destroy_sample_instance(music_wrapper->instance);
+    release_cached_music(&music_wrapper->decoded);
     destroy_audio_stream(music_wrapper->music);
     free(music_wrapper);
 }
@@ -309,12 +1173,14 @@ void destroy_music_wrapper(Music *music_wrapper) {
  * @brief Libera todos os recurosos utilizados pelo SoundBank.
  */
 void destroy_sound_bank() {
-    destroy_sfx_wrapper(sb.player_shoot);
-    destroy_sfx_wrapper(sb.player_hit);
-    destroy_sfx_wrapper(sb.alien_shoot);
-    destroy_sfx_wrapper(sb.alien_die);
-    destroy_sfx_wrapper(sb.game_over);
-    destroy_music_wrapper(sb.playing_bg);
-    destroy_music_wrapper(sb.title_screen);
-    destroy_music_wrapper(sb.calm_music);
+    stop_audio_thread();
+    destroy_audio_stream(mixer_stream);
+    mixer_stream = NULL;
+
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        destroy_sfx_wrapper(sb.sfx[id]);
+        destroy_music_wrapper(sb.music[id]);
+        sb.sfx[id] = NULL;
+        sb.music[id] = NULL;
+    }
 }
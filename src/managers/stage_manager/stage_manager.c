@@ -143,7 +143,7 @@ void distribute_aliens(StageConfig config, AlienManager *alien_manager) {
     int index = 0;
     for (int i = 0; i < ALIENS_TYPE_AMOUNT; i++) {
         for (int j = 0; j < config.alien_distribution[i].rows * alien_manager->columns; j++, index++) {
-            alien_manager->aliens[index] = create_alien(get_alien_config(config.alien_distribution[i].type), index, 
+            init_alien(&alien_manager->aliens[index], get_alien_config(config.alien_distribution[i].type), index, 
             ALIEN_ANIMATION_FRAMES, alien_manager->move_interval);
         }
     }
@@ -214,4 +214,30 @@ void next_stage(StageManager *stage_manager) {
  */
 void reset_stage_manager(StageManager *stage_manager) {
     stage_manager->current_stage = 0;
+}
+
+/**
+ * @brief Retorna o maior número de aliens de uma formação entre todos os estágios, usado para 
+ * reservar a formação uma única vez por sessão.
+ * 
+ * @return Quantidade máxima de aliens em um estágio.
+ */
+int get_max_stage_aliens() {
+    int max = 0;
+
+    for (int i = 0; i < get_stage_count(); i++) {
+        int count = get_total_rows(STAGES[i]) * STAGES[i].columns;
+        if (count > max) max = count;
+    }
+
+    return max;
+}
+
+/**
+ * @brief Retorna a quantidade de estágios configurados em STAGES.
+ * 
+ * @return Quantidade de estágios.
+ */
+int get_stage_count() {
+    return sizeof(STAGES) / sizeof(STAGES[0]);
 }
\ No newline at end of file
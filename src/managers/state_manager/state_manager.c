@@ -45,7 +45,8 @@ void set_game_state(GameState new_state, bool enter_state) {
  * @brief Entra em uma estado primeiro passando por um estado de transição.
  * 
  * @param next_state Próximo estado a ser definido.
- * @param time Tempo em segudos até que seja definido o novo estado.
+ * @param time Tempo mínimo em segundos até que seja definido o novo estado, a transição também espera
+ * o carregamento dos assets do próximo estado.
  * @param enter_state Boolean define se deve ou não ser executada a função enter do estado.  
  */
 void enter_state_with_transition(GameState next_state, double time, bool enter_state) {
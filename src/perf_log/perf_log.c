@@ -0,0 +1,66 @@
+#include "perf_log.h"
+#include <allegro5/allegro.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+static FILE *perf_log = NULL;
+
+/**
+ * @brief Abre (ou cria) o arquivo de log de performance. As novas linhas são adicionadas ao fim 
+ * do arquivo, assim várias execuções podem ser comparadas.
+ * 
+ * @param path Caminho do arquivo.
+ * 
+ * @return Bool indicando se o arquivo foi aberto.
+ */
+bool open_perf_log(const char *path) {
+    perf_log = fopen(path, "a");
+
+    if (!perf_log) {
+        fprintf(stderr, "Failed to open perf log: %s\n", path);
+        return false;
+    }
+
+    write_perf_log("session", "start");
+
+    return true;
+}
+
+/**
+ * @brief Verifica se o log de performance está aberto.
+ * 
+ * @return Bool indicando se há um log aberto.
+ */
+bool is_perf_log_open() {
+    return perf_log != NULL;
+}
+
+/**
+ * @brief Escreve uma linha no log de performance no formato "<tempo> <seção> <mensagem>", onde 
+ * o tempo é o tempo em segundos desde que o allegro foi iniciado.
+ * 
+ * @param section Nome da seção, ex: "audio".
+ * @param format Formato da mensagem, como em printf.
+ */
+void write_perf_log(const char *section, const char *format, ...) {
+    if (!perf_log) return;
+
+    va_list args;
+
+    fprintf(perf_log, "%.3f %s ", al_get_time(), section);
+    va_start(args, format);
+    vfprintf(perf_log, format, args);
+    va_end(args);
+    fputc('\n', perf_log);
+}
+
+/**
+ * @brief Fecha o log de performance.
+ */
+void close_perf_log() {
+    if (!perf_log) return;
+
+    write_perf_log("session", "end");
+    fclose(perf_log);
+    perf_log = NULL;
+}
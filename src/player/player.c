@@ -3,37 +3,24 @@
 #include "bullet.h"
 #include "bullet_manager.h"
 #include "sound_manager.h"
+#include "game_clock.h"
+#include "snapshot.h"
+#include "sprite_cache.h"
+#include "session_arena.h"
+#include "asset_paths.h"
 
-#define PLAYER_SPRITE_PATH "../assets/images/sprites/player/player_sprite_sheet.png"
-#define PLAYER_BULLET_SPRITE_PATH "../assets/images/sprites/player/player_bullet.png"
 #define MAX_SCORE 9999999
 
 /**
- * @brief Aloca memária para a estrutura Player, inicializa com base nas configurações passadas e retorna
- * um ponteiro para a estrutura criada.
+ * @brief Inicializa a estrutura Player com base nas configurações passadas, usando o pool de balas 
+ * e o animator recebidos.
  * 
+ * @param p Ponteiro para o player.
  * @param cfg Configurações para a estrutura player (velocidade, altura, largura etc).
- * 
- * @return Player.
+ * @param bm Pool de balas do player.
+ * @param animator Animator do player.
  */
-Player *create_player(PlayerConfig cfg) {
-    Player *p = (Player *) malloc(sizeof(Player));
-
-    if (!p) {
-        fprintf(stderr, "Failed to create player.\n");
-        exit(-1);
-    }
-
-    BulletManager *bm = create_bullet_manager(cfg.max_bullets, 
-            cfg.bullet_config, get_sprite(PLAYER_BULLET_SPRITE_PATH));
-
-    Animator *animator = (Animator *) malloc(sizeof(Animator));
-
-    if (!animator) {
-        fprintf(stderr, "Failed to create player animator.\n");
-        exit(-1);
-    }
-
+void init_player(Player *p, PlayerConfig cfg, BulletManager *bm, Animator *animator) {
     init_animator(animator, cfg.animation_frames, cfg.width, cfg.height, 
         cfg.frame_duration, true);
 
@@ -58,7 +45,7 @@ Player *create_player(PlayerConfig cfg) {
         .lifes = cfg.lifes,
         .max_life = cfg.max_life,
         .fire_interval = cfg.fire_interval,
-        .last_fire_time = al_get_time(),
+        .last_fire_time = get_game_time(),
         .color = al_map_rgb(cfg.color.red, cfg.color.green, cfg.color.blue),
         .score = cfg.score,
         .is_alive = cfg.is_alive,
@@ -66,10 +53,38 @@ Player *create_player(PlayerConfig cfg) {
         .animator = animator,
         .draw_hitbox = cfg.draw_hitbox,
     };
+}
+
+/**
+ * @brief Aloca a estrutura Player na arena da sessão, inicializa com base nas configurações passadas e retorna
+ * um ponteiro para a estrutura criada.
+ * 
+ * @param cfg Configurações para a estrutura player (velocidade, altura, largura etc).
+ * 
+ * @return Player.
+ */
+Player *create_player(PlayerConfig cfg) {
+    Player *p = (Player *) session_alloc(sizeof(Player));
+    BulletManager *bm = create_bullet_manager(cfg.max_bullets, 
+            cfg.bullet_config, get_sprite(PLAYER_BULLET_SPRITE_PATH));
+    Animator *animator = (Animator *) session_alloc(sizeof(Animator));
+
+    init_player(p, cfg, bm, animator);
 
     return p;
 }
 
+/**
+ * @brief Reinicia o player para o começo de um estágio, reaproveitando seu pool de balas e animator.
+ * 
+ * @param p Ponteiro para o player.
+ * @param cfg Configurações para a estrutura player.
+ */
+void reset_player(Player *p, PlayerConfig cfg) {
+    reset_bullet_manager(p->bm);
+    init_player(p, cfg, p->bm, p->animator);
+}
+
 /**
  * @brief Define a posição do player, caso a nova posição esteja fora dos limites da tela
  * ela será corrigida para dentro dos limites.
@@ -169,7 +184,7 @@ void handle_player_movement(Player *p) {
  * @return Bool indicando se o player pode atirar.
  */
 bool player_can_fire(Player *p) {
-    double now = al_get_time();
+    double now = get_game_time();
     double delta_time = now - p->last_fire_time;
 
     return (p->bm->quantity < p->bm->max) && 
@@ -178,7 +193,7 @@ bool player_can_fire(Player *p) {
 
 /**
  * @brief Dispara um projétil, toca o som de tiro e atualiza o a variável last_fire_time
- * utilizando al_get_time.
+ * utilizando get_game_time.
  * 
  * @param p Ponteiro para o player.
  */
@@ -186,7 +201,7 @@ void player_fire_bullet(Player *p) {
     if (player_can_fire(p)) {
         play_sound(SFX_PLAYER_SHOOT);
         fire_bullet(p->bm, get_collider(p->pos, p->width, p->height));
-        p->last_fire_time = al_get_time();
+        p->last_fire_time = get_game_time();
     }
 }
 
@@ -318,23 +333,6 @@ void draw_player(Player *p) {
             p->pos.y + p->height, p->color, 0);
 }
 
-/**
- * @brief Libera os recusos utilizados pela estrutura Player.
- * 
- * @param p Ponteiro para o player.
- */
-void destroy_player(Player *p) {
-    if (!p) return;
-
-    destroy_bullet_manager(p->bm);
-    destroy_animator(p->animator);
-
-    if (p->sprite)
-        al_destroy_bitmap(p->sprite);
-    
-    free(p);
-}
-
 /**
  * @brief Define o estado lógico do player para morto.
  * 
@@ -368,4 +366,79 @@ void hit_player(Player *p) {
 void player_hits_enemy(Player *p, int points) {
     if (p->score < MAX_SCORE)
         p->score += points;
+}
+
+/**
+ * @brief Copia o estado mutável do player, incluindo suas balas e animação, para um PlayerState.
+ * 
+ * @param p Ponteiro para o player.
+ * @param state Ponteiro para o PlayerState que receberá o estado.
+ * 
+ * @return Bool indicando se o estado coube no PlayerState.
+ */
+bool save_player_state(Player *p, PlayerState *state) {
+    state->pos = p->pos;
+    state->acc = p->acc;
+    state->vx = p->vx;
+    state->move_left = p->move_left;
+    state->move_right = p->move_right;
+    state->is_shooting = p->is_shooting;
+    state->is_alive = p->is_alive;
+    state->lifes = p->lifes;
+    state->score = p->score;
+    state->last_fire_time = p->last_fire_time;
+    save_animator_state(p->animator, &state->animator);
+
+    return save_bullets_state(p->bm, &state->bullets);
+}
+
+/**
+ * @brief Restaura o estado mutável do player a partir de um PlayerState.
+ * 
+ * @param p Ponteiro para o player.
+ * @param state Ponteiro para o PlayerState salvo.
+ */
+void restore_player_state(Player *p, const PlayerState *state) {
+    p->pos = state->pos;
+    p->acc = state->acc;
+    p->vx = state->vx;
+    p->move_left = state->move_left;
+    p->move_right = state->move_right;
+    p->is_shooting = state->is_shooting;
+    p->is_alive = state->is_alive;
+    p->lifes = state->lifes;
+    p->score = state->score;
+    p->last_fire_time = state->last_fire_time;
+    restore_animator_state(p->animator, &state->animator);
+    restore_bullets_state(p->bm, &state->bullets);
+}
+
+/**
+ * @brief Retorna os comandos que o player está executando (esquerda, direita e disparo)
+ * como um conjunto de flags PLAYER_INPUT_*.
+ * 
+ * @param p Ponteiro para o player.
+ * 
+ * @return Flags dos comandos ativos.
+ */
+unsigned char get_player_input_flags(Player *p) {
+    unsigned char flags = 0;
+
+    if (p->move_left) flags |= PLAYER_INPUT_LEFT;
+    if (p->move_right) flags |= PLAYER_INPUT_RIGHT;
+    if (p->is_shooting) flags |= PLAYER_INPUT_SHOOT;
+
+    return flags;
+}
+
+/**
+ * @brief Define os comandos que o player está executando a partir de um conjunto de flags PLAYER_INPUT_*.
+ * 
+ * @param p Ponteiro para o player.
+ * @param flags Flags dos comandos ativos.
+ */
+void set_player_input_flags(Player *p, unsigned char flags) {
+    set_move_left(p, flags & PLAYER_INPUT_LEFT);
+    set_move_right(p, flags & PLAYER_INPUT_RIGHT);
+    set_shooting(p, flags & PLAYER_INPUT_SHOOT);
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "replay.h"
+#include "snapshot.h"
+#include "game_clock.h"
+#include "game_context.h"
+#include "playing_scene.h"
+#include "state_manager.h"
+#include "screen_config.h"
+#include "utils.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+static FILE *record_file = NULL;
+
+/**
+ * @brief Escreve um valor no arquivo de replay.
+ *
+ * @return Bool indicando se o valor foi escrito.
+ */
+bool write_replay_value(FILE *file, const void *value, size_t size) {
+    return fwrite(value, size, 1, file) == 1;
+}
+
+/**
+ * @brief Lê um valor do arquivo de replay.
+ *
+ * @return Bool indicando se o valor foi lido.
+ */
+bool read_replay_value(FILE *file, void *value, size_t size) {
+    return fread(value, size, 1, file) == 1;
+}
+
+/**
+ * @brief Abre o arquivo de replay para gravação e escreve seu cabeçalho.
+ *
+ * @param path Caminho do arquivo.
+ *
+ * @return Bool indicando se o arquivo foi criado.
+ */
+bool start_replay_recording(const char *path) {
+    uint32_t magic = REPLAY_MAGIC;
+    uint32_t version = REPLAY_VERSION;
+
+    record_file = fopen(path, "wb");
+
+    if (!record_file) {
+        fprintf(stderr, "Failed to create replay file: %s\n", path);
+        return false;
+    }
+
+    write_replay_value(record_file, &magic, sizeof(magic));
+    write_replay_value(record_file, &version, sizeof(version));
+
+    return true;
+}
+
+/**
+ * @brief Grava o início de um novo segmento (estágio) com o estado necessário para recriá-lo.
+ * Deve ser chamada antes de o playing state criar seus objetos.
+ */
+void record_replay_segment() {
+    if (!record_file) return;
+
+    StageManager *stage = get_stage_manager();
+    ReplaySegment segment = {
+        .current_stage = stage->current_stage,
+        .move_interval_multiplier = stage->move_interval_multiplier,
+        .fire_rate_multiplier = stage->fire_rate_multiplier,
+        .player_score = get_player_score(),
+        .rng_state = get_random_state(),
+        .game_time = get_game_time(),
+    };
+    unsigned char type = REPLAY_RECORD_SEGMENT;
+
+    write_replay_value(record_file, &type, sizeof(type));
+    write_replay_value(record_file, &segment.current_stage, sizeof(segment.current_stage));
+    write_replay_value(record_file, &segment.move_interval_multiplier, sizeof(segment.move_interval_multiplier));
+    write_replay_value(record_file, &segment.fire_rate_multiplier, sizeof(segment.fire_rate_multiplier));
+    write_replay_value(record_file, &segment.player_score, sizeof(segment.player_score));
+    write_replay_value(record_file, &segment.rng_state, sizeof(segment.rng_state));
+    write_replay_value(record_file, &segment.game_time, sizeof(segment.game_time));
+}
+
+/**
+ * @brief Grava um tick da partida, os comandos do player usados no tick e o hash do estado resultante.
+ *
+ * @param input Flags PLAYER_INPUT_* ativas durante o tick.
+ * @param state_hash Hash do estado da simulação após o tick.
+ */
+void record_replay_tick(unsigned char input, uint64_t state_hash) {
+    if (!record_file) return;
+
+    unsigned char type = REPLAY_RECORD_TICK;
+
+    write_replay_value(record_file, &type, sizeof(type));
+    write_replay_value(record_file, &input, sizeof(input));
+    write_replay_value(record_file, &state_hash, sizeof(state_hash));
+}
+
+/**
+ * @brief Finaliza a gravação e fecha o arquivo de replay.
+ */
+void stop_replay_recording() {
+    if (!record_file) return;
+
+    fclose(record_file);
+    record_file = NULL;
+}
+
+/**
+ * @brief Lê o cabeçalho de um segmento do arquivo de replay.
+ *
+ * @return Bool indicando se o segmento foi lido.
+ */
+bool read_replay_segment(FILE *file, ReplaySegment *segment) {
+    return read_replay_value(file, &segment->current_stage, sizeof(segment->current_stage)) &&
+        read_replay_value(file, &segment->move_interval_multiplier, sizeof(segment->move_interval_multiplier)) &&
+        read_replay_value(file, &segment->fire_rate_multiplier, sizeof(segment->fire_rate_multiplier)) &&
+        read_replay_value(file, &segment->player_score, sizeof(segment->player_score)) &&
+        read_replay_value(file, &segment->rng_state, sizeof(segment->rng_state)) &&
+        read_replay_value(file, &segment->game_time, sizeof(segment->game_time));
+}
+
+/**
+ * @brief Lê um tick do arquivo de replay.
+ *
+ * @return Bool indicando se o tick foi lido.
+ */
+bool read_replay_tick(FILE *file, ReplayTick *tick) {
+    return read_replay_value(file, &tick->input, sizeof(tick->input)) &&
+        read_replay_value(file, &tick->state_hash, sizeof(tick->state_hash));
+}
+
+/**
+ * @brief Recria o início de um segmento: relógio, gerador pseudo-aleatório, score e estágio,
+ * e então entra no playing state.
+ *
+ * @param segment Ponteiro para o segmento lido.
+ */
+void start_replay_segment(const ReplaySegment *segment) {
+    StageManager *stage = get_stage_manager();
+
+    if (get_game_state() == STATE_PLAYING)
+        exit_game_state(STATE_EXIT, false);
+
+    stage->current_stage = segment->current_stage;
+    stage->move_interval_multiplier = segment->move_interval_multiplier;
+    stage->fire_rate_multiplier = segment->fire_rate_multiplier;
+    stage->stage_cleared = false;
+    set_player_score(segment->player_score);
+    set_game_over(false);
+    set_player_win(false);
+    set_random_state(segment->rng_state);
+    set_game_time(segment->game_time);
+    set_game_state(STATE_PLAYING, true);
+}
+
+/**
+ * @brief Executa um tick gravado, aplicando os comandos do player e avançando a simulação.
+ *
+ * @param tick Ponteiro para o tick lido.
+ *
+ * @return Bool indicando se a partida continuou após o tick, como na gravação.
+ */
+bool run_replay_tick(const ReplayTick *tick) {
+    if (get_game_state() != STATE_PLAYING) return false;
+
+    set_playing_input(tick->input);
+    advance_game_clock(FPS);
+    update_game();
+
+    return get_game_state() == STATE_PLAYING;
+}
+
+/**
+ * @brief Reproduz um arquivo de replay sem janela, comparando o hash do estado a cada tick, e informa
+ * o primeiro tick em que a simulação divergiu da gravação.
+ *
+ * @param path Caminho do arquivo.
+ *
+ * @return 0 se o replay foi reproduzido sem divergências, 1 se houve divergência e -1 em caso de erro.
+ */
+int verify_replay(const char *path) {
+    FILE *file = fopen(path, "rb");
+    uint32_t magic = 0, version = 0;
+    unsigned char type;
+    ReplaySegment segment;
+    ReplayTick tick;
+    int segments = 0;
+    long ticks = 0, segment_tick = 0;
+    int result = 0;
+
+    if (!file) {
+        fprintf(stderr, "Failed to open replay file: %s\n", path);
+        return -1;
+    }
+
+    if (!read_replay_value(file, &magic, sizeof(magic)) || magic != REPLAY_MAGIC ||
+        !read_replay_value(file, &version, sizeof(version)) || version != REPLAY_VERSION) {
+        fprintf(stderr, "Invalid replay file: %s\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    while (result == 0 && read_replay_value(file, &type, sizeof(type))) {
+        if (type == REPLAY_RECORD_SEGMENT && read_replay_segment(file, &segment)) {
+            start_replay_segment(&segment);
+            segments++;
+            segment_tick = 0;
+            continue;
+        }
+
+        if (type != REPLAY_RECORD_TICK || segments == 0 || !read_replay_tick(file, &tick)) {
+            fprintf(stderr, "Corrupted replay file at tick %ld.\n", ticks);
+            result = -1;
+            break;
+        }
+
+        if (!run_replay_tick(&tick)) {
+            printf("Desync at tick %ld (stage segment %d, tick %ld): session ended before the recording.\n",
+                ticks, segments, segment_tick);
+            result = 1;
+            break;
+        }
+
+        uint64_t state_hash = get_state_hash();
+
+        if (state_hash != tick.state_hash) {
+            printf("Desync at tick %ld (stage segment %d, tick %ld): expected %016" PRIx64 ", got %016" PRIx64 ".\n",
+                ticks, segments, segment_tick, tick.state_hash, state_hash);
+            result = 1;
+            break;
+        }
+
+        ticks++;
+        segment_tick++;
+    }
+
+    if (result == 0)
+        printf("Replay verified: %ld ticks in %d segments, no desync.\n", ticks, segments);
+
+    if (get_game_state() == STATE_PLAYING)
+        exit_game_state(STATE_EXIT, false);
+
+    fclose(file);
+
+    return result;
+}
@@ -0,0 +1,286 @@
+#include "rewind_buffer.h"
+#include "snapshot.h"
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_RUN_LENGTH UINT16_MAX
+#define MIN_ZERO_RUN 4
+#define MAX_ENCODED_SIZE (sizeof(GameSnapshot) * 2 + 16)
+
+/**
+ * @brief Estrutura que representa um frame salvo no buffer, a posição e o tamanho do delta
+ * codificado dentro da área de dados.
+ */
+typedef struct RewindRecord {
+    int offset;
+    int size;
+} RewindRecord;
+
+/**
+ * @brief Estrutura utilizada para guardar os últimos segundos de jogo. Somente o snapshot mais
+ * recente é guardado por completo, cada frame anterior é guardado como o XOR entre ele e o
+ * frame seguinte, comprimido com run-length nas sequências de zeros. Como o XOR é simétrico,
+ * aplicar o delta sobre o snapshot mais recente reconstrói o frame anterior.
+ */
+typedef struct RewindBuffer {
+    GameSnapshot head;
+    bool has_head;
+    RewindRecord records[REWIND_MAX_FRAMES];
+    int oldest;
+    int count;
+    int write_pos;
+    unsigned char data[REWIND_BUFFER_BYTES];
+    unsigned char scratch[MAX_ENCODED_SIZE];
+} RewindBuffer;
+
+static RewindBuffer rb;
+
+/**
+ * @brief Descarta todos os frames salvos.
+ */
+void clear_rewind_buffer() {
+    rb.has_head = false;
+    rb.oldest = 0;
+    rb.count = 0;
+    rb.write_pos = 0;
+}
+
+/**
+ * @brief Escreve um inteiro de 16 bits no buffer de saída.
+ *
+ * @param out Ponteiro para o buffer.
+ * @param value Valor a ser escrito.
+ *
+ * @return Ponteiro para a posição seguinte ao valor escrito.
+ */
+unsigned char *write_run_length(unsigned char *out, int value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    return out + 2;
+}
+
+/**
+ * @brief Lê um inteiro de 16 bits do buffer de entrada.
+ *
+ * @param in Ponteiro para o buffer.
+ *
+ * @return Valor lido.
+ */
+int read_run_length(const unsigned char *in) {
+    return in[0] | (in[1] << 8);
+}
+
+/**
+ * @brief Conta quantos bytes do XOR entre dois buffers são zero a partir de uma posição.
+ *
+ * @param a Primeiro buffer.
+ * @param b Segundo buffer.
+ * @param pos Posição inicial.
+ * @param size Tamanho dos buffers.
+ *
+ * @return Quantidade de bytes iguais consecutivos.
+ */
+int count_equal_bytes(const unsigned char *a, const unsigned char *b, int pos, int size) {
+    int start = pos;
+
+    while (pos < size && pos - start < MAX_RUN_LENGTH && a[pos] == b[pos])
+        pos++;
+
+    return pos - start;
+}
+
+/**
+ * @brief Conta quantos bytes diferentes devem entrar no próximo bloco literal, pequenas
+ * sequências de bytes iguais ficam dentro do bloco para evitar blocos fragmentados.
+ *
+ * @param a Primeiro buffer.
+ * @param b Segundo buffer.
+ * @param pos Posição inicial.
+ * @param size Tamanho dos buffers.
+ *
+ * @return Tamanho do bloco literal.
+ */
+int count_literal_bytes(const unsigned char *a, const unsigned char *b, int pos, int size) {
+    int start = pos;
+
+    while (pos < size && pos - start < MAX_RUN_LENGTH) {
+        if (a[pos] == b[pos] && count_equal_bytes(a, b, pos, size) >= MIN_ZERO_RUN)
+            break;
+        pos++;
+    }
+
+    if (pos - start > MAX_RUN_LENGTH)
+        pos = start + MAX_RUN_LENGTH;
+
+    return pos - start;
+}
+
+/**
+ * @brief Codifica o XOR entre dois snapshots como uma sequência de blocos
+ * (quantidade de zeros, quantidade de bytes literais, bytes literais).
+ *
+ * @param previous Snapshot anterior.
+ * @param current Snapshot atual.
+ * @param out Buffer que receberá o delta codificado.
+ *
+ * @return Tamanho em bytes do delta codificado.
+ */
+int encode_delta(const GameSnapshot *previous, const GameSnapshot *current, unsigned char *out) {
+    const unsigned char *a = (const unsigned char *) previous;
+    const unsigned char *b = (const unsigned char *) current;
+    int size = sizeof(GameSnapshot);
+    unsigned char *cursor = out;
+    int pos = 0;
+
+    while (pos < size) {
+        int zeros = count_equal_bytes(a, b, pos, size);
+        pos += zeros;
+
+        int literals = count_literal_bytes(a, b, pos, size);
+
+        cursor = write_run_length(cursor, zeros);
+        cursor = write_run_length(cursor, literals);
+
+        for (int i = 0; i < literals; i++, pos++)
+            *cursor++ = a[pos] ^ b[pos];
+    }
+
+    return cursor - out;
+}
+
+/**
+ * @brief Aplica um delta codificado sobre um snapshot, revertendo-o para o frame anterior.
+ *
+ * @param snapshot Snapshot a ser modificado.
+ * @param in Delta codificado.
+ * @param encoded_size Tamanho do delta codificado.
+ */
+void apply_delta(GameSnapshot *snapshot, const unsigned char *in, int encoded_size) {
+    unsigned char *bytes = (unsigned char *) snapshot;
+    const unsigned char *end = in + encoded_size;
+    int pos = 0;
+
+    while (in < end) {
+        pos += read_run_length(in);
+        int literals = read_run_length(in + 2);
+        in += 4;
+
+        for (int i = 0; i < literals; i++)
+            bytes[pos++] ^= *in++;
+    }
+}
+
+/**
+ * @brief Descarta o frame mais antigo do buffer.
+ */
+void evict_oldest_record() {
+    rb.oldest = (rb.oldest + 1) % REWIND_MAX_FRAMES;
+    rb.count--;
+}
+
+/**
+ * @brief Verifica se o frame mais antigo ocupa alguma parte de uma região da área de dados.
+ *
+ * @param offset Início da região.
+ * @param size Tamanho da região.
+ *
+ * @return Bool indicando se há sobreposição.
+ */
+bool oldest_overlaps(int offset, int size) {
+    RewindRecord *oldest = &rb.records[rb.oldest];
+    return oldest->offset < offset + size && oldest->offset + oldest->size > offset;
+}
+
+/**
+ * @brief Reserva uma região contígua na área de dados, descartando os frames mais antigos
+ * quando o limite de memória ou de frames é atingido.
+ *
+ * @param size Tamanho da região.
+ *
+ * @return Posição da região reservada.
+ */
+int reserve_record_space(int size) {
+    if (rb.count == REWIND_MAX_FRAMES)
+        evict_oldest_record();
+
+    if (rb.write_pos + size > REWIND_BUFFER_BYTES) {
+        while (rb.count > 0 && rb.records[rb.oldest].offset >= rb.write_pos)
+            evict_oldest_record();
+
+        rb.write_pos = 0;
+    }
+
+    while (rb.count > 0 && oldest_overlaps(rb.write_pos, size))
+        evict_oldest_record();
+
+    int offset = rb.write_pos;
+    rb.write_pos += size;
+
+    return offset;
+}
+
+/**
+ * @brief Salva um novo frame no buffer, o frame anterior passa a ser guardado como delta.
+ *
+ * @param snapshot Snapshot do tick atual.
+ */
+void push_rewind_frame(const GameSnapshot *snapshot) {
+    if (!rb.has_head) {
+        rb.head = *snapshot;
+        rb.has_head = true;
+        return;
+    }
+
+    int size = encode_delta(&rb.head, snapshot, rb.scratch);
+    int offset = reserve_record_space(size);
+    int index = (rb.oldest + rb.count) % REWIND_MAX_FRAMES;
+
+    memcpy(&rb.data[offset], rb.scratch, size);
+    rb.records[index] = (RewindRecord) {.offset = offset, .size = size};
+    rb.count++;
+    rb.head = *snapshot;
+}
+
+/**
+ * @brief Volta um frame no tempo, o frame mais recente é descartado.
+ *
+ * @param snapshot Ponteiro para o GameSnapshot que receberá o frame anterior.
+ *
+ * @return Bool indicando se ainda havia um frame anterior disponível.
+ */
+bool rewind_frame(GameSnapshot *snapshot) {
+    if (rb.count == 0) return false;
+
+    int index = (rb.oldest + rb.count - 1) % REWIND_MAX_FRAMES;
+    RewindRecord *record = &rb.records[index];
+
+    apply_delta(&rb.head, &rb.data[record->offset], record->size);
+    rb.write_pos = record->offset;
+    rb.count--;
+    *snapshot = rb.head;
+
+    return true;
+}
+
+/**
+ * @brief Retorna quantos frames anteriores ainda podem ser restaurados.
+ *
+ * @return Quantidade de frames.
+ */
+int get_rewind_frame_count() {
+    return rb.count;
+}
+
+/**
+ * @brief Retorna quantos bytes da área de dados estão ocupados pelos deltas.
+ *
+ * @return Quantidade de bytes.
+ */
+int get_rewind_bytes_used() {
+    int used = 0;
+
+    for (int i = 0; i < rb.count; i++)
+        used += rb.records[(rb.oldest + i) % REWIND_MAX_FRAMES].size;
+
+    return used;
+}
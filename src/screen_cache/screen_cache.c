@@ -0,0 +1,72 @@
+#include "screen_cache.h"
+#include "screen_config.h"
+#include "bitmap_audit.h"
+#include <allegro5/allegro.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static ScreenCache cache = {
+    .bitmap = NULL,
+    .drawer = NULL,
+    .dirty = true,
+};
+
+/**
+ * @brief Marca as camadas estáticas para serem redesenhadas no próximo frame, usada na entrada dos 
+ * estados ou quando algo fixo da tela muda.
+ */
+void invalidate_screen_cache() {
+    cache.dirty = true;
+}
+
+/**
+ * @brief Compõe as camadas estáticas no bitmap do cache.
+ * 
+ * @param drawer Função que desenha as camadas estáticas.
+ */
+void render_screen_cache(StaticLayersDrawer drawer) {
+    ALLEGRO_BITMAP *target = al_get_target_bitmap();
+
+    if (!cache.bitmap) {
+        cache.bitmap = al_create_bitmap(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+        if (!cache.bitmap) {
+            fprintf(stderr, "Failed to create screen cache bitmap.\n");
+            exit(-1);
+        }
+    }
+
+    al_set_target_bitmap(cache.bitmap);
+    al_clear_to_color(al_map_rgb(0, 0, 0));
+    drawer();
+    al_set_target_bitmap(target);
+
+    cache.drawer = drawer;
+    cache.dirty = false;
+}
+
+/**
+ * @brief Desenha as camadas estáticas da tela ativa a partir do cache, redesenhando o cache somente 
+ * se ele foi invalidado ou se pertence a outra tela.
+ * 
+ * @param drawer Função que desenha as camadas estáticas da tela ativa.
+ */
+void draw_screen_cache(StaticLayersDrawer drawer) {
+    if (cache.dirty || cache.drawer != drawer)
+        render_screen_cache(drawer);
+
+    audit_bitmap(cache.bitmap, "draw_screen_cache");
+    al_draw_bitmap(cache.bitmap, 0, 0, 0);
+}
+
+/**
+ * @brief Libera o bitmap do cache, deve ser chamada antes de destruir o display.
+ */
+void destroy_screen_cache() {
+    if (cache.bitmap)
+        al_destroy_bitmap(cache.bitmap);
+
+    cache.bitmap = NULL;
+    cache.drawer = NULL;
+    cache.dirty = true;
+}
@@ -0,0 +1,70 @@
+#include "session_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdalign.h>
+
+static SessionArena arena = {
+    .memory = NULL,
+    .size = SESSION_ARENA_SIZE,
+    .used = 0,
+    .peak = 0,
+};
+
+/**
+ * @brief Aloca memória da arena da sessão, alinhada para qualquer tipo. O bloco da arena é criado 
+ * na primeira alocação.
+ * 
+ * @param size Quantidade de bytes.
+ * 
+ * @return Ponteiro para a memória alocada (não inicializada).
+ */
+void *session_alloc(size_t size) {
+    size_t align = alignof(max_align_t);
+    size_t start = (arena.used + align - 1) & ~(align - 1);
+
+    if (!arena.memory) {
+        arena.memory = (unsigned char *) malloc(arena.size);
+
+        if (!arena.memory) {
+            fprintf(stderr, "Failed to create session arena.\n");
+            exit(-1);
+        }
+    }
+
+    if (start + size > arena.size) {
+        fprintf(stderr, "Session arena out of memory (%zu of %zu bytes used, %zu requested).\n", 
+            arena.used, arena.size, size);
+        exit(-1);
+    }
+
+    arena.used = start + size;
+
+    if (arena.used > arena.peak) arena.peak = arena.used;
+
+    return arena.memory + start;
+}
+
+/**
+ * @brief Descarta todas as alocações da sessão, o bloco é mantido para a próxima sessão.
+ */
+void reset_session_arena() {
+    arena.used = 0;
+}
+
+/**
+ * @brief Retorna o maior uso da arena desde o início do programa, útil para ajustar SESSION_ARENA_SIZE.
+ * 
+ * @return Bytes.
+ */
+size_t get_session_arena_peak() {
+    return arena.peak;
+}
+
+/**
+ * @brief Libera o bloco da arena.
+ */
+void destroy_session_arena() {
+    free(arena.memory);
+    arena.memory = NULL;
+    arena.used = 0;
+}
@@ -0,0 +1,61 @@
+#include "snapshot.h"
+#include "game_clock.h"
+#include "game_context.h"
+#include "playing_scene.h"
+#include "utils.h"
+#include <string.h>
+
+/**
+ * @brief Copia campo a campo o estado de um StageManager para outro.
+ * 
+ * @param from Ponteiro para o StageManager de origem.
+ * @param to Ponteiro para o StageManager de destino.
+ */
+void copy_stage_state(const StageManager *from, StageManager *to) {
+    to->current_stage = from->current_stage;
+    to->move_interval_multiplier = from->move_interval_multiplier;
+    to->fire_rate_multiplier = from->fire_rate_multiplier;
+    to->stage_cleared = from->stage_cleared;
+}
+
+/**
+ * @brief Salva todo o estado mutável da simulação (partida, estágio, contexto, relógio e gerador
+ * pseudo-aleatório) em um único buffer plano, sem ponteiros.
+ * 
+ * @param snapshot Ponteiro para o GameSnapshot que receberá o estado.
+ * 
+ * @return Bool indicando se existe uma partida em andamento e se o estado foi salvo.
+ */
+bool odi_snapshot_save(GameSnapshot *snapshot) {
+    memset(snapshot, 0, sizeof(GameSnapshot));
+
+    snapshot->game_time = get_game_time();
+    snapshot->rng_state = get_random_state();
+    snapshot->player_score = get_player_score();
+    snapshot->is_game_over = is_game_over();
+    snapshot->player_win = has_player_win();
+    copy_stage_state(get_stage_manager(), &snapshot->stage);
+
+    return save_playing_scene(snapshot);
+}
+
+/**
+ * @brief Restaura todo o estado mutável da simulação a partir de um GameSnapshot, nada é alterado
+ * caso o snapshot não seja compatível com a partida em andamento.
+ * 
+ * @param snapshot Ponteiro para o GameSnapshot salvo.
+ * 
+ * @return Bool indicando se o estado foi restaurado.
+ */
+bool odi_snapshot_restore(const GameSnapshot *snapshot) {
+    if (!restore_playing_scene(snapshot)) return false;
+
+    set_game_time(snapshot->game_time);
+    set_random_state(snapshot->rng_state);
+    set_player_score(snapshot->player_score);
+    set_game_over(snapshot->is_game_over);
+    set_player_win(snapshot->player_win);
+    copy_stage_state(&snapshot->stage, get_stage_manager());
+
+    return true;
+}
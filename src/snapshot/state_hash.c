@@ -0,0 +1,178 @@
+#include "state_hash.h"
+#include "snapshot.h"
+#include <string.h>
+
+#define FNV_OFFSET_BASIS 0xCBF29CE484222325ULL
+#define FNV_PRIME 0x100000001B3ULL
+
+/**
+ * @brief Mistura uma sequência de bytes no hash (FNV-1a de 64 bits).
+ *
+ * @param hash Hash atual.
+ * @param data Ponteiro para os bytes.
+ * @param size Quantidade de bytes.
+ *
+ * @return Novo hash.
+ */
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *) data;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Mistura um inteiro no hash.
+ */
+uint64_t hash_int(uint64_t hash, int64_t value) {
+    return hash_bytes(hash, &value, sizeof(value));
+}
+
+/**
+ * @brief Mistura um float no hash usando sua representação binária, diferenças mínimas
+ * de arredondamento também alteram o hash.
+ */
+uint64_t hash_float(uint64_t hash, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return hash_bytes(hash, &bits, sizeof(bits));
+}
+
+/**
+ * @brief Mistura um double no hash usando sua representação binária.
+ */
+uint64_t hash_double(uint64_t hash, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return hash_bytes(hash, &bits, sizeof(bits));
+}
+
+/**
+ * @brief Mistura um Point no hash.
+ */
+uint64_t hash_point(uint64_t hash, Point point) {
+    hash = hash_float(hash, point.x);
+    return hash_float(hash, point.y);
+}
+
+/**
+ * @brief Mistura o estado de um Animator no hash.
+ */
+uint64_t hash_animator(uint64_t hash, const AnimatorState *state) {
+    hash = hash_int(hash, state->current_frame);
+    return hash_double(hash, state->last_update);
+}
+
+/**
+ * @brief Mistura o estado de uma bullet pool no hash.
+ */
+uint64_t hash_bullets(uint64_t hash, const BulletPoolState *state) {
+    hash = hash_int(hash, state->max);
+    hash = hash_int(hash, state->quantity);
+
+    for (int i = 0; i < state->max && i < SNAPSHOT_MAX_BULLETS; i++) {
+        hash = hash_point(hash, state->bullets[i].pos);
+        hash = hash_int(hash, state->bullets[i].is_active);
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Mistura o estado do player no hash.
+ */
+uint64_t hash_player(uint64_t hash, const PlayerState *state) {
+    hash = hash_point(hash, state->pos);
+    hash = hash_float(hash, state->acc);
+    hash = hash_float(hash, state->vx);
+    hash = hash_int(hash, state->move_left);
+    hash = hash_int(hash, state->move_right);
+    hash = hash_int(hash, state->is_shooting);
+    hash = hash_int(hash, state->is_alive);
+    hash = hash_int(hash, state->lifes);
+    hash = hash_int(hash, state->score);
+    hash = hash_float(hash, state->last_fire_time);
+    hash = hash_animator(hash, &state->animator);
+    return hash_bullets(hash, &state->bullets);
+}
+
+/**
+ * @brief Mistura o estado da formação de aliens no hash.
+ */
+uint64_t hash_formation(uint64_t hash, const AlienFormationState *state) {
+    hash = hash_int(hash, state->count);
+    hash = hash_int(hash, state->alives);
+    hash = hash_int(hash, state->mov_dir);
+    hash = hash_double(hash, state->last_move_time);
+    hash = hash_float(hash, state->last_fire_time);
+
+    for (int i = 0; i < state->count && i < SNAPSHOT_MAX_ALIENS; i++) {
+        hash = hash_point(hash, state->aliens[i].pos);
+        hash = hash_int(hash, state->aliens[i].is_alive);
+        hash = hash_animator(hash, &state->aliens[i].animator);
+    }
+
+    return hash_bullets(hash, &state->bullets);
+}
+
+/**
+ * @brief Mistura o estado do UFO no hash.
+ */
+uint64_t hash_ufo(uint64_t hash, const UFOState *state) {
+    hash = hash_point(hash, state->pos);
+    hash = hash_float(hash, state->speed);
+    hash = hash_int(hash, state->mov_dir);
+    hash = hash_int(hash, state->is_active);
+    hash = hash_int(hash, state->points);
+    hash = hash_double(hash, state->last_spawn);
+    return hash_animator(hash, &state->animator);
+}
+
+/**
+ * @brief Mistura o estado das explosões no hash.
+ */
+uint64_t hash_explosions(uint64_t hash, const ExplosionPoolState *state) {
+    hash = hash_int(hash, state->max);
+    hash = hash_int(hash, state->count);
+
+    for (int i = 0; i < state->max && i < SNAPSHOT_MAX_EXPLOSIONS; i++) {
+        hash = hash_point(hash, state->explosions[i].pos);
+        hash = hash_float(hash, state->explosions[i].timer);
+        hash = hash_int(hash, state->explosions[i].active);
+        hash = hash_animator(hash, &state->explosions[i].animator);
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Calcula um hash de 64 bits de todo o estado da simulação contido em um GameSnapshot.
+ * O hash é feito campo a campo, assim bytes de padding não influenciam o resultado.
+ *
+ * @param snapshot Ponteiro para o GameSnapshot.
+ *
+ * @return Hash do estado.
+ */
+uint64_t hash_game_snapshot(const GameSnapshot *snapshot) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    hash = hash_double(hash, snapshot->game_time);
+    hash = hash_bytes(hash, &snapshot->rng_state, sizeof(snapshot->rng_state));
+    hash = hash_int(hash, snapshot->player_score);
+    hash = hash_int(hash, snapshot->is_game_over);
+    hash = hash_int(hash, snapshot->player_win);
+    hash = hash_int(hash, snapshot->stage.current_stage);
+    hash = hash_float(hash, snapshot->stage.move_interval_multiplier);
+    hash = hash_float(hash, snapshot->stage.fire_rate_multiplier);
+    hash = hash_int(hash, snapshot->stage.stage_cleared);
+    hash = hash_double(hash, snapshot->last_update);
+    hash = hash_player(hash, &snapshot->player);
+    hash = hash_formation(hash, &snapshot->formation);
+    hash = hash_ufo(hash, &snapshot->ufo);
+
+    return hash_explosions(hash, &snapshot->explosions);
+}
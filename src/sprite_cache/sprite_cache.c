@@ -0,0 +1,94 @@
+#include "sprite_cache.h"
+#include <allegro5/allegro.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static SpriteCache cache = {
+    .count = 0,
+};
+
+/**
+ * @brief Procura um sprite no cache.
+ * 
+ * @param path Caminho da imagem.
+ * 
+ * @return O bitmap do sprite ou NULL se ele ainda não foi carregado.
+ */
+ALLEGRO_BITMAP *find_cached_sprite(const char *path) {
+    for (int i = 0; i < cache.count; i++) {
+        if (strcmp(cache.sprites[i].path, path) == 0)
+            return cache.sprites[i].bitmap;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Verifica se um sprite já está no cache.
+ * 
+ * @param path Caminho da imagem.
+ * 
+ * @return Bool indicando se o sprite está no cache.
+ */
+bool is_sprite_cached(const char *path) {
+    return find_cached_sprite(path) != NULL;
+}
+
+/**
+ * @brief Adiciona ao cache um sprite carregado fora dele (ex: pelo asset loader), o cache passa a 
+ * ser o dono do bitmap.
+ * 
+ * @param path Caminho de onde a imagem foi carregada.
+ * @param bitmap Bitmap carregado.
+ */
+void add_sprite(const char *path, ALLEGRO_BITMAP *bitmap) {
+    if (is_sprite_cached(path)) {
+        al_destroy_bitmap(bitmap);
+        return;
+    }
+
+    if (cache.count == SPRITE_CACHE_SIZE) {
+        fprintf(stderr, "Sprite cache is full, unable to add: %s.\n", path);
+        exit(-1);
+    }
+
+    CachedSprite *sprite = &cache.sprites[cache.count++];
+
+    snprintf(sprite->path, sizeof(sprite->path), "%s", path);
+    sprite->bitmap = bitmap;
+}
+
+/**
+ * @brief Retorna o sprite de um caminho, carregando-o com al_load_bitmap somente na primeira vez.
+ * 
+ * @param path Caminho para a imagem a ser carregada.
+ * 
+ * @return Um ALLEGRO_BITMAP compartilhado representando a imagem.
+ */
+ALLEGRO_BITMAP *get_sprite(const char *path) {
+    ALLEGRO_BITMAP *sprite = find_cached_sprite(path);
+
+    if (sprite) return sprite;
+
+    sprite = al_load_bitmap(path);
+
+    if (!sprite) {
+        fprintf(stderr, "Unable to load sprite in path: %s.\n", path);
+        exit(-1);
+    }
+
+    add_sprite(path, sprite);
+
+    return sprite;
+}
+
+/**
+ * @brief Libera todos os sprites do cache.
+ */
+void destroy_sprite_cache() {
+    for (int i = 0; i < cache.count; i++)
+        al_destroy_bitmap(cache.sprites[i].bitmap);
+
+    cache.count = 0;
+}
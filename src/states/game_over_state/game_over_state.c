@@ -8,6 +8,8 @@
 #include "score_manager.h"
 #include "sound_manager.h"
 #include "background_manager.h"
+#include "screen_cache.h"
+#include "asset_paths.h"
 #include "state_manager.h"
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_font.h>
@@ -15,7 +17,6 @@
 #include <stdio.h>
 #include <string.h>
 
-#define GAME_OVER_BG_PATH "../assets/images/bg/game_over_bg.png"
 #define PLAYER_WIN_MESSAGE "The alien ivasion has been stopped. Good work!"
 #define PLAYER_LOSE_MESSAGE "Earth is now under the control of the aliens"
 
@@ -28,6 +29,7 @@ void enter_game_over_state() {
     load_background(get_background_manager(), GAME_OVER_BG_PATH);
     sfx_id = has_player_win() ? SFX_GAME_WIN : SFX_GAME_OVER;
     play_sound(sfx_id);
+    invalidate_screen_cache();
 }
 
 /**
@@ -74,13 +76,13 @@ void handle_game_over_input(ALLEGRO_EVENT event) {
 
             exit_game_over_state();
             reset_game_context();
-            enter_state_with_transition(STATE_PLAYING, 0.3, true);
+            enter_state_with_transition(STATE_PLAYING, 0, true);
             return;
         } 
 
         exit_game_over_state();
         next_stage(get_stage_manager());
-        enter_state_with_transition(STATE_PLAYING, 0.3, true);
+        enter_state_with_transition(STATE_PLAYING, 0, true);
     }
 }
 
@@ -113,10 +115,10 @@ void draw_game_over_message(const char *message, float *current_y) {
 }
 
 /**
- * @brief Desenha a tela de game over, opções e mensagem.
+ * @brief Desenha as camadas estáticas do game over (background, overlay, opções e mensagem) 
+ * no cache da tela.
  */
-void draw_game_over() {
-    al_clear_to_color(al_map_rgb(0, 0, 0));
+void draw_game_over_layers() {
     draw_background(get_background_manager());
     draw_screen_overlay((RGB) {.red = 0, .green = 0, .blue = 0}, 150);
 
@@ -133,6 +135,13 @@ void draw_game_over() {
     current_y += 100;
   
     draw_options(&current_y);
+}
+
+/**
+ * @brief Desenha a tela de game over, opções e mensagem.
+ */
+void draw_game_over() {
+    draw_screen_cache(draw_game_over_layers);
 
     al_flip_display();
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "font_manager.h"
 #include "game_context.h"
 #include "background_manager.h"
+#include "screen_cache.h"
+#include "asset_paths.h"
 #include <allegro5/allegro_image.h>
 #include <allegro5/allegro_audio.h>
 #include <allegro5/allegro_font.h>
@@ -13,7 +15,6 @@
 #include <allegro5/allegro_primitives.h>
 #include <stdio.h>
 
-#define MENU_BACKGROUND_PATH "../assets/images/bg/menu_bg.png"
 #define OPTIONS_X SCREEN_WIDTH / 2
 #define OPTIONS_GAP 50
 #define OPTS_COUNT 3
@@ -28,16 +29,16 @@ const char OPTIONS[OPTS_COUNT][100] = {"Press enter to Start", "Press H to score
  * @brief função usada para carregar os artefatos necessários ao menu state.
  */
 void enter_menu_state() {
-    play_music(TITLE_SCREEN);
-    load_background(get_background_manager(), MENU_BACKGROUND_PATH);
+    fade_in_music(TITLE_SCREEN, MUSIC_FADE_TIME);
+    load_background(get_background_manager(), MENU_BG_PATH);
+    invalidate_screen_cache();
 }
 
 /**
  * @brief Libera os recursos usados pelo menu state.
  */
 void clean_up_menu_state() {
-    remove_music(TITLE_SCREEN);
-    rewind_music(TITLE_SCREEN);
+    fade_out_music(TITLE_SCREEN, MUSIC_FADE_TIME);
 }
 
 /**
@@ -56,7 +57,7 @@ void exit_menu_state(GameState state, bool enter_state) {
  */
 void exit_menu_state_with_transition(GameState state) {
     clean_up_menu_state();
-    enter_state_with_transition(state, .2, true);
+    enter_state_with_transition(state, 0, true);
 }
 
 /**
@@ -117,13 +118,12 @@ void draw_menu_title(ALLEGRO_COLOR text_color, int *current_y) {
 }
 
 /**
- * @brief Desenha o menu, titulo e opções.
+ * @brief Desenha as camadas estáticas do menu (background, titulo e opções) no cache da tela.
  */
-void draw_menu() {
+void draw_menu_layers() {
     ALLEGRO_COLOR text_color = al_map_rgb(255, 255, 255);
     int current_y = 100;
 
-    al_clear_to_color(al_map_rgb(0, 0, 0));
     draw_background(get_background_manager());
 
     draw_menu_title(text_color, &current_y);
@@ -131,6 +131,13 @@ void draw_menu() {
     current_y += 170;
 
     draw_menu_options(&current_y, text_color, OPTIONS_GAP);
+}
+
+/**
+ * @brief Desenha o menu, titulo e opções.
+ */
+void draw_menu() {
+    draw_screen_cache(draw_menu_layers);
     
     al_flip_display();
 }
\ No newline at end of file
@@ -14,10 +14,16 @@
 #include "ufo_manager.h"
 #include "stage_manager.h"
 #include "explosion_manager.h"
+#include "game_clock.h"
+#include "snapshot.h"
+#include "rewind_buffer.h"
+#include "game_options.h"
+#include "state_hash.h"
+#include "replay.h"
+#include "asset_paths.h"
+#include "session_arena.h"
 #include <allegro5/allegro_image.h>
 
-#define BG1_PATH "../assets/images/bg/playing_bg.png"
-
 #define DANGER_LINE_Y SCREEN_HEIGHT - (PLAYER_CONFIG.height + SCREEN_BOTTOM_MARGIN)
 #define GAME_MAX_EXPLOSIONS 16
 
@@ -26,40 +32,78 @@ static Player *player = NULL;
 static ExplosionManager *explosion_manager = NULL; 
 static AlienManager *alien_manager = NULL;
 static UFO *ufo = NULL;
+static bool _is_rewinding = false;
+static GameSnapshot _tick_snapshot;
+static uint64_t _state_hash = 0;
 
 /**
- * @brief função usada para carregar os artefatos necessários ao playing state.
+ * @brief Cria os objetos da sessão de jogo (player, aliens, UFO e explosões) com seus pools, todos 
+ * na arena da sessão. Eles vivem até destroy_playing_session e são só reiniciados a cada entrada 
+ * no playing state.
  */
-void enter_playing_state() {
+void create_playing_session() {
     player = create_player(PLAYER_CONFIG);
-    player->score = get_player_score();
     alien_manager = create_alien_manager();
+    reserve_aliens(alien_manager, get_max_stage_aliens());
     ufo = create_ufo();
     explosion_manager = create_explosion_manager();
     init_explosion_manager(explosion_manager, GAME_MAX_EXPLOSIONS);
+}
+
+/**
+ * @brief Reinicia os objetos da sessão para o começo de um estágio, sem alocar nem carregar texturas.
+ */
+void reset_playing_session() {
+    reset_player(player, PLAYER_CONFIG);
+    init_ufo(ufo);
+    reset_explosion_manager(explosion_manager);
+}
+
+/**
+ * @brief função usada para carregar os artefatos necessários ao playing state.
+ */
+void enter_playing_state() {
+    record_replay_segment();
+    _last_update = get_game_time();
+
+    if (player)
+        reset_playing_session();
+    else
+        create_playing_session();
+
+    player->score = get_player_score();
     start_stage(get_stage_manager(), alien_manager);
     spawn_aliens(alien_manager);
-    load_background(get_background_manager(), BG1_PATH);
-    play_music(PLAYING_BG_MUSIC);
+    load_background(get_background_manager(), PLAYING_BG_PATH);
+    fade_in_music(PLAYING_BG_MUSIC, MUSIC_FADE_TIME);
     init_ui();
+    clear_rewind_buffer();
+    _is_rewinding = false;
 }
 
 /**
- * @brief Libera os recursos usados pelo playing state.
+ * @brief Finaliza o playing state. Os objetos da sessão continuam vivos para o próximo estágio, 
+ * só o som do UFO é parado.
  */
 void clean_up_game_state() {
-    remove_music(PLAYING_BG_MUSIC);
-    rewind_music(PLAYING_BG_MUSIC);
-    destroy_player(player);
-    destroy_alien_manager(alien_manager);
-    destroy_explosion_manager(explosion_manager);
-    destroy_ufo(ufo);
+    fade_out_music(PLAYING_BG_MUSIC, MUSIC_FADE_TIME);
+    deactive_ufo(ufo);
+} 
+
+/**
+ * @brief Libera os recursos da sessão de jogo, deve ser chamada no encerramento do programa. Toda a 
+ * memória da sessão é descartada de uma vez com a arena.
+ */
+void destroy_playing_session() {
+    if (ufo) deactive_ufo(ufo);
     destroy_ui();
     player = NULL;
     alien_manager = NULL;
     ufo = NULL;
     explosion_manager = NULL;
-} 
+    reset_session_arena();
+    destroy_session_arena();
+}
 
 /**
  * @brief Libera os recursos usados pelo playing state e define o próximo estado.
@@ -115,11 +159,42 @@ bool update_game_logic() {
     return true;
 }
 
+/**
+ * @brief Volta a partida um tick no tempo usando o buffer de rewind.
+ * 
+ * @return Bool indicando se ainda havia um tick anterior para ser restaurado.
+ */
+bool rewind_game() {
+    if (!rewind_frame(&_tick_snapshot)) return false;
+
+    return odi_snapshot_restore(&_tick_snapshot);
+}
+
+/**
+ * @brief Salva o estado do tick atual, calcula seu hash, grava o tick no replay (se houver gravação)
+ * e, no modo prática, salva o estado no buffer de rewind.
+ * 
+ * @param input Flags dos comandos do player usados no tick.
+ */
+void record_tick(unsigned char input) {
+    if (!odi_snapshot_save(&_tick_snapshot)) return;
+
+    _state_hash = hash_game_snapshot(&_tick_snapshot);
+    record_replay_tick(input, _state_hash);
+
+    if (get_game_options()->practice_mode)
+        push_rewind_frame(&_tick_snapshot);
+}
+
 /**
  * @brief Faz o update da lógica do playing state e das explosões, caso o jogo tenha acado entra no extado game over.
+ * No modo prática, enquanto a tecla de rewind estiver pressionada, a partida volta um tick por update.
  */
 void update_game() {
-    double now = al_get_time();
+    if (_is_rewinding && rewind_game()) return;
+
+    unsigned char input = get_player_input_flags(player);
+    double now = get_game_time();
     double delta_time = now  - _last_update;
     _last_update = now;
 
@@ -130,6 +205,7 @@ void update_game() {
     }
 
     update_explosions(explosion_manager, delta_time);
+    record_tick(input);
 }
 
 /**
@@ -149,6 +225,11 @@ void handle_game_input(ALLEGRO_EVENT event) {
         return;
     }
 
+    if (get_game_options()->practice_mode) {
+        if (key_pressed(event, ALLEGRO_KEY_R)) _is_rewinding = true;
+        if (key_released(event, ALLEGRO_KEY_R)) _is_rewinding = false;
+    }
+
     handle_player_events(player, interpret_player_event(&event));
 }
 
@@ -178,3 +259,76 @@ void draw_game() {
 void on_kill_enemy(Rect collider) {
     trigger_explosion(explosion_manager, collider);
 }
+
+/**
+ * @brief Copia o estado mutável da partida em andamento (player, aliens, ufo e explosões) 
+ * para um GameSnapshot.
+ * 
+ * @param snapshot Ponteiro para o GameSnapshot que receberá o estado.
+ * 
+ * @return Bool indicando se existe uma partida em andamento e se ela coube no snapshot.
+ */
+bool save_playing_scene(GameSnapshot *snapshot) {
+    if (!player || !alien_manager || !ufo || !explosion_manager) return false;
+
+    snapshot->last_update = _last_update;
+    save_ufo_state(ufo, &snapshot->ufo);
+
+    return save_player_state(player, &snapshot->player) &&
+        save_alien_formation_state(alien_manager, &snapshot->formation) &&
+        save_explosions_state(explosion_manager, &snapshot->explosions);
+}
+
+/**
+ * @brief Verifica se um GameSnapshot foi salvo de uma partida com a mesma estrutura da atual
+ * (mesma formação de aliens e mesmos tamanhos de bullet pools e explosões).
+ * 
+ * @param snapshot Ponteiro para o GameSnapshot.
+ * 
+ * @return Bool indicando se o snapshot pode ser restaurado na partida atual.
+ */
+bool is_snapshot_compatible(const GameSnapshot *snapshot) {
+    return snapshot->formation.count == alien_manager->count &&
+        snapshot->formation.bullets.max == alien_manager->bm->max &&
+        snapshot->player.bullets.max == player->bm->max &&
+        snapshot->explosions.max == GAME_MAX_EXPLOSIONS;
+}
+
+/**
+ * @brief Restaura o estado mutável da partida em andamento a partir de um GameSnapshot, nada é 
+ * alterado caso o snapshot não seja compatível com a partida atual.
+ * 
+ * @param snapshot Ponteiro para o GameSnapshot salvo.
+ * 
+ * @return Bool indicando se o estado foi restaurado.
+ */
+bool restore_playing_scene(const GameSnapshot *snapshot) {
+    if (!player || !alien_manager || !ufo || !explosion_manager) return false;
+    if (!is_snapshot_compatible(snapshot)) return false;
+
+    _last_update = snapshot->last_update;
+    restore_player_state(player, &snapshot->player);
+    restore_alien_formation_state(alien_manager, &snapshot->formation);
+    restore_ufo_state(ufo, &snapshot->ufo);
+    restore_explosions_state(explosion_manager, &snapshot->explosions);
+
+    return true;
+}
+
+/**
+ * @brief Define os comandos do player da partida em andamento, usado ao reproduzir um replay.
+ * 
+ * @param flags Flags PLAYER_INPUT_* ativas.
+ */
+void set_playing_input(unsigned char flags) {
+    if (player) set_player_input_flags(player, flags);
+}
+
+/**
+ * @brief Retorna o hash do estado da simulação calculado no último tick.
+ * 
+ * @return Hash de 64 bits.
+ */
+uint64_t get_state_hash() {
+    return _state_hash;
+}
\ No newline at end of file
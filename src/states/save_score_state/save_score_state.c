@@ -5,16 +5,17 @@
 #include "score_manager.h"
 #include "game_context.h"
 #include "background_manager.h"
+#include "screen_cache.h"
+#include "asset_paths.h"
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro_ttf.h>
 #include <string.h>
 #include <stdio.h>
 
-#define SAVE_SCORE_BACKGROUND_PATH "../assets/images/bg/save_score_bg.png"
-
 static char name[NAME_LENGTH + 1] = "";
 static GameState _next_state = STATE_MENU;
+static float name_y = 0;
 
 /**
  * @brief função usada para carregar os artefatos necessários ao save score state, e recebe o próximo state para ser acessado
@@ -24,7 +25,8 @@ static GameState _next_state = STATE_MENU;
  */
 void enter_save_score_state(GameState next_state) {
     _next_state = next_state;
-    load_background(get_background_manager(), SAVE_SCORE_BACKGROUND_PATH);
+    load_background(get_background_manager(), SAVE_SCORE_BG_PATH);
+    invalidate_screen_cache();
 }
 
 /**
@@ -121,11 +123,10 @@ void draw_save_score_options(float *current_y) {
 }
 
 /**
- * @brief Desenha a tela de save score, a table contendo os maiores scores registrados 
- * as entradas do player para definir seu nome e o seu score.
+ * @brief Desenha as camadas estáticas do save score state (background, títulos e table de scores) 
+ * no cache da tela.
  */
-void draw_save_score_state() {
-    al_clear_to_color(al_map_rgb(0, 0, 0));
+void draw_save_score_layers() {
     draw_background(get_background_manager());
 
     float current_y = SCREEN_HEIGHT * 0.2;
@@ -142,7 +143,18 @@ void draw_save_score_state() {
 
     draw_score_table(&current_y, get_small_font());
 
-     current_y += 20;
+    name_y = current_y + 20;
+}
+
+/**
+ * @brief Desenha a tela de save score, a table contendo os maiores scores registrados 
+ * as entradas do player para definir seu nome e o seu score. Só o nome e as opções são 
+ * redesenhados a cada frame, o resto vem do cache da tela.
+ */
+void draw_save_score_state() {
+    draw_screen_cache(draw_save_score_layers);
+
+    float current_y = name_y;
 
     char buffer[24];
     char formatted_name[NAME_LENGTH + 1];
@@ -6,18 +6,18 @@
 #include "screen_config.h"
 #include "game_context.h"
 #include "sound_manager.h"
+#include "screen_cache.h"
+#include "asset_paths.h"
 #include <stdbool.h>
 
 #define TOP_MARGIN 50
-#define SCORE_RANK_STATE_BG_PATH "../assets/images/bg/score_rank_bg.png"
 #define ENCOURAGING_PHRASE "No one survived. Ready to try?"
 
 /**
  * @brief Libera os recursos usados pelo score rank state.
  */
 void clean_up_score_rank_state() {
-    remove_music(CALM_MUSIC);
-    rewind_music(CALM_MUSIC);
+    fade_out_music(CALM_MUSIC, MUSIC_FADE_TIME);
 }
 
 /**
@@ -35,8 +35,9 @@ void exit_score_rank_state(GameState next_state, bool enter_state) {
  * @brief função usada para carregar os artefatos necessários ao score rank state.
  */
 void enter_score_rank_state() {
-    load_background(get_background_manager(), SCORE_RANK_STATE_BG_PATH);
-    play_music(CALM_MUSIC);
+    load_background(get_background_manager(), SCORE_RANK_BG_PATH);
+    fade_in_music(CALM_MUSIC, MUSIC_FADE_TIME);
+    invalidate_screen_cache();
 }
 
 /**
@@ -73,13 +74,12 @@ void draw_score_rank_options(ALLEGRO_COLOR text_color, float y) {
 }
 
 /**
- * @brief Desenha o score rank state, table contendo os maiores scores.
+ * @brief Desenha as camadas estáticas do score rank state (background, table e opções) no cache da tela.
  */
-void draw_score_rank() {
+void draw_score_rank_layers() {
     ALLEGRO_COLOR text_color = al_map_rgb(255, 255, 255);
     float current_y = TOP_MARGIN;
 
-    al_clear_to_color(al_map_rgb(0, 0, 0));
     draw_background(get_background_manager());
 
     al_draw_text(get_large_font(), text_color, SCREEN_WIDTH / 2, current_y, 
@@ -98,6 +98,13 @@ void draw_score_rank() {
         current_y += 50;
         draw_score_rank_options(text_color, current_y);
     }
+}
+
+/**
+ * @brief Desenha o score rank state, table contendo os maiores scores.
+ */
+void draw_score_rank() {
+    draw_screen_cache(draw_score_rank_layers);
     
     al_flip_display();
 }
@@ -3,28 +3,48 @@
 #include <stdbool.h>
 #include "font_manager.h"
 #include "screen_config.h"
+#include "game_clock.h"
+#include "asset_loader.h"
+#include "asset_paths.h"
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro_ttf.h>
 
 #define BOTTOM_PADDING 30
 
+static const char *playing_assets[] = {
+    PLAYER_SPRITE_PATH,
+    PLAYER_BULLET_SPRITE_PATH,
+    TOXIC_ALIEN_SPRITE_PATH,
+    RAGE_ALIEN_SPRITE_PATH,
+    SPOOKY_ALIEN_SPRITE_PATH,
+    ALIEN_BULLET_SPRITE_PATH,
+    UFO_SPRITE_PATH,
+    EXPLOSION_SPRITE_PATH,
+    LIFE_ICON_ACTIVE_PATH,
+    LIFE_ICON_DEACTIVE_PATH,
+};
+
 static GameState next_state;
 static double state_timer;
 static double transition_time;
 static double enter_state;
 
 /**
- * @brief Faz as configurações para a transição para o próximo state.
+ * @brief Faz as configurações para a transição para o próximo state e inicia o carregamento em 
+ * background dos sprites que ele usa.
  * 
  * @param state Próximo GameState.
- * @param time Tempo em segundo da transição.
+ * @param time Tempo mínimo em segundos da transição, 0 para sair assim que os assets carregarem.
  * @param enter Um bool indicando se a função enter do próximo estado deve ser executada. 
  */
 void enter_transition_state(GameState state, double time, bool enter) {
     next_state = state;
-    state_timer = al_get_time();
+    state_timer = get_game_time();
     transition_time = time;
     enter_state = enter;
+
+    if (state == STATE_PLAYING)
+        start_asset_loading(playing_assets, sizeof(playing_assets) / sizeof(playing_assets[0]));
 }
 
 /**
@@ -35,29 +55,28 @@ void exit_transition() {
 }
 
 /**
- * @brief Desenha uma mensagem de carregamento.
+ * @brief Desenha uma mensagem de carregamento com o progresso real do carregamento dos assets.
  */
 void draw_transition() {
     ALLEGRO_COLOR text_color = al_map_rgb(255, 255, 255);
-    char *text = "Loading...";
 
     al_clear_to_color(al_map_rgb(0, 0, 0));
 
-    al_draw_text(get_small_font(), text_color, 
+    al_draw_textf(get_small_font(), text_color, 
         SCREEN_HORIZONTAL_MARGIN, SCREEN_HEIGHT - BOTTOM_PADDING, 
-        ALLEGRO_ALIGN_LEFT, text);
+        ALLEGRO_ALIGN_LEFT, "Loading... %d%%", (int) (get_asset_loading_progress() * 100));
 
     al_flip_display();
 }
 
 /**
- * @brief Fax a atualização da lógica do transition state, verifica se 
- * já é o momento para sair do estado.
+ * @brief Fax a atualização da lógica do transition state, sai do estado quando os assets 
+ * terminaram de carregar e o tempo mínimo da transição passou.
  */
 void update_transition_state() {
-    double now = al_get_time();
+    double now = get_game_time();
     double delta_time = now - state_timer;
 
-    if (delta_time >= transition_time) 
+    if (delta_time >= transition_time && finish_asset_loading()) 
         exit_transition();   
 }
@@ -6,10 +6,11 @@
 #include "font_manager.h"
 #include "game_context.h"
 #include "score_manager.h"
+#include "bitmap_audit.h"
+#include "sprite_cache.h"
+#include "asset_paths.h"
 #include <allegro5/allegro_color.h>
 
-#define LIFE_ICON_ACTIVE_PATH "../assets/images/icons/player_life.png"
-#define LIFE_ICON_DEACTIVE_PATH "../assets/images/icons/player_life_low_opacity.png"
 #define ICONS_GAP 10
 #define ICONS_WIDTH 24
 #define ICONS_HEIGHT 24
@@ -29,7 +30,9 @@ const Rect UI_wrapper = {
 static UI ui;
 
 /**
- * @brief Inicializa a UI, cor do texto, fonte utilizada, icons, etc.
+ * @brief Inicializa a UI, cor do texto, fonte utilizada, icons, etc. O maior score registrado é 
+ * lido uma vez aqui, a tabela de scores não muda durante a partida. O bitmap da HUD é criado só na 
+ * primeira chamada e reaproveitado nos estágios seguintes.
  */
 void init_ui() {
     ui.text_color = al_map_rgb(255, 255, 255);
@@ -37,55 +40,106 @@ void init_ui() {
     ui.wrapper = UI_wrapper;
     ui.life_icon_active = get_sprite(LIFE_ICON_ACTIVE_PATH);
     ui.life_icon_deactive = get_sprite(LIFE_ICON_DEACTIVE_PATH);
+
+    if (!ui.hud) {
+        int line_height = al_get_font_line_height(ui.font);
+        ui.hud = al_create_bitmap(ui.wrapper.width, line_height > ICONS_HEIGHT ? line_height : ICONS_HEIGHT);
+    }
+
+    if (!ui.hud) {
+        fprintf(stderr, "Failed to create hud bitmap.\n");
+        exit(-1);
+    }
+
+    ui.hud_state.max_score = get_highest_score(get_score_table());
+    ui.hud_dirty = true;
 }
 
 /**
- * @brief Desenha icons na tela que representam a vida atual do player.
+ * @brief Desenha icons na HUD que representam a vida atual do player.
  * 
  * @param max_lifes Vida máxima do player.
  * @param lifes Quantidade atual de vidas do player.
  */
 void draw_player_lifes(int max_lifes, int lifes) {
     for (int i = 0; i < max_lifes; i++) {
-        al_draw_bitmap(i < lifes ? ui.life_icon_active : ui.life_icon_deactive, 
-            ui.wrapper.pos.x + ((ICONS_WIDTH + ICONS_GAP) * i), ui.wrapper.pos.y, 0);
+        ALLEGRO_BITMAP *icon = i < lifes ? ui.life_icon_active : ui.life_icon_deactive;
+
+        audit_bitmap(icon, "draw_player_lifes");
+        al_draw_bitmap(icon, (ICONS_WIDTH + ICONS_GAP) * i, 0, 0);
     }
 }
 
 /**
- * @brief Desenha o maior score registrado e o score atual do player na tela.
+ * @brief Desenha o estágio, o maior score registrado e o score atual do player na HUD.
  * 
+ * @param stage Estágio atual.
  * @param max_score Maior score registrado.
  * @param player_score Score atual do player.
  */
-void draw_score(int max_score, int player_score) {
+void draw_score(int stage, int max_score, int player_score) {
     char buffer1[64];
-    sprintf(buffer1, "Stage: %d  <Max: %.7d>  Score: %.7d",
-        get_stage_manager()->current_stage,  max_score, player_score);
+    sprintf(buffer1, "Stage: %d  <Max: %.7d>  Score: %.7d", stage, max_score, player_score);
+
+    al_draw_text(ui.font, ui.text_color, ui.wrapper.width, 0, ALLEGRO_ALIGN_RIGHT, buffer1);
+}
+
+/**
+ * @brief Redesenha a HUD no seu bitmap com os valores atuais.
+ */
+void render_hud() {
+    ALLEGRO_BITMAP *target = al_get_target_bitmap();
+
+    al_set_target_bitmap(ui.hud);
+    al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+    draw_score(ui.hud_state.stage, ui.hud_state.max_score, ui.hud_state.player_score);
+    draw_player_lifes(ui.hud_state.max_lifes, ui.hud_state.lifes);
+    al_set_target_bitmap(target);
+
+    ui.hud_dirty = false;
+}
+
+/**
+ * @brief Atualiza um valor da HUD, marcando-a para ser redesenhada se o valor mudou.
+ * 
+ * @param field Ponteiro para o valor em hud_state.
+ * @param value Novo valor.
+ */
+void set_hud_value(int *field, int value) {
+    if (*field == value) return;
 
-    al_draw_text(ui.font, ui.text_color, ui.wrapper.pos.x + ui.wrapper.width, 
-        ui.wrapper.pos.y, ALLEGRO_ALIGN_RIGHT, buffer1);
+    *field = value;
+    ui.hud_dirty = true;
 }
 
 /**
- * @brief Desenha a UI na tela contendo informações sobre o player e sobre o estágio atual.
+ * @brief Desenha a UI na tela contendo informações sobre o player e sobre o estágio atual. A HUD 
+ * só é redesenhada quando algum dos valores mudou.
  * 
  * @param max_lifes Vida máxima do player.
  * @param lifes Vida atual do player.
  * @param player_score Score atual do player. 
  */
 void draw_ui(int max_lifes, int lifes, int player_score) {
-    draw_score(get_highest_score(get_score_table()), player_score);
-    draw_player_lifes(max_lifes, lifes);
+    set_hud_value(&ui.hud_state.stage, get_stage_manager()->current_stage);
+    set_hud_value(&ui.hud_state.player_score, player_score);
+    set_hud_value(&ui.hud_state.max_lifes, max_lifes);
+    set_hud_value(&ui.hud_state.lifes, lifes);
+
+    if (ui.hud_dirty) render_hud();
+
+    audit_bitmap(ui.hud, "draw_ui");
+    al_draw_bitmap(ui.hud, ui.wrapper.pos.x, ui.wrapper.pos.y, 0);
 }
 
 /**
  * @brief Libera os recursos utilizados pela UI.
  */
 void destroy_ui() {
-    if (ui.life_icon_active)
-        al_destroy_bitmap(ui.life_icon_active);
+    if (ui.hud)
+        al_destroy_bitmap(ui.hud);
 
-    if (ui.life_icon_deactive)
-        al_destroy_bitmap(ui.life_icon_deactive);
+    ui.life_icon_active = NULL;
+    ui.life_icon_deactive = NULL;
+    ui.hud = NULL;
 }
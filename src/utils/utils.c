@@ -46,11 +46,62 @@ Rect get_collider(Point pos, int width, int height) {
     return collider;
 }
 
+/// Estado do gerador pseudo-aleatório (xorshift64*), nunca deve ser zero.
+static uint64_t rng_state = RNG_DEFAULT_SEED;
+static TextLayout text_layouts[TEXT_LAYOUT_CACHE_SIZE];
+static int next_text_layout = 0;
+
 /**
- * @brief Define a seed a função srand com a função time. 
+ * @brief Define a seed do gerador pseudo-aleatório. A seed passa por uma etapa
+ * do splitmix64 para que seeds pequenas ou parecidas gerem estados bem distribuídos.
+ * 
+ * @param seed Seed a ser utilizada.
+ */
+void set_random_seed(uint64_t seed) {
+    uint64_t z = seed + RNG_DEFAULT_SEED;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+
+    rng_state = z ? z : RNG_DEFAULT_SEED;
+}
+
+/**
+ * @brief Define a seed do gerador pseudo-aleatório com a função time. 
  */
 void set_time_seed() {
-    srand(time(NULL));
+    set_random_seed((uint64_t) time(NULL));
+}
+
+/**
+ * @brief Retorna o estado atual do gerador pseudo-aleatório.
+ * 
+ * @return Estado do gerador.
+ */
+uint64_t get_random_state() {
+    return rng_state;
+}
+
+/**
+ * @brief Restaura o estado do gerador pseudo-aleatório.
+ * 
+ * @param state Estado previamente obtido com get_random_state.
+ */
+void set_random_state(uint64_t state) {
+    rng_state = state ? state : RNG_DEFAULT_SEED;
+}
+
+/**
+ * @brief Avança o gerador pseudo-aleatório e retorna os 32 bits mais significativos.
+ * 
+ * @return Um inteiro sem sinal pseudo-aleatório.
+ */
+uint32_t next_random() {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+
+    return (uint32_t) ((rng_state * 0x2545F4914F6CDD1DULL) >> 32);
 }
 
 /**
@@ -62,7 +113,7 @@ void set_time_seed() {
  * @return Um número inteiro pseudo-aleatório dentro do intervalo estipulado.
  */
 int random_integer(int min, int max) {
-    return rand() % (max - min + 1) + min;
+    return next_random() % (uint32_t) (max - min + 1) + min;
 }
 
 /**
@@ -71,37 +122,31 @@ int random_integer(int min, int max) {
  * @return Um float pseudo-aleatório.
  */
 float random_float() {
-    return ((float)rand()) / RAND_MAX; 
+    return (float) (next_random() / (double) UINT32_MAX); 
 }
 
 /**
- * @brief Carrega um ALLEGRO_BITMAP usando a função al_load_bitmap.
+ * @breif Verifica se uma determinada tecla do teclado foi pressionada.
  * 
- * @param path Caminho para a imagem a ser carregada.
+ * @param event O evento disparado.
+ * @param key_code Representando o codigo da tecla a ser verificada.
  * 
- * @return Um ALLEGRO_BITMAP representado uma imagem.
+ * @return Bool indicando se a tecla foi pressionada.
  */
-ALLEGRO_BITMAP * get_sprite(const char *path) {
-     ALLEGRO_BITMAP * sprite = al_load_bitmap(path);
-
-    if (!sprite) {
-        fprintf(stderr, "Unable to load sprite in path: %s.\n", path);
-        exit(-1);
-    }
-
-    return sprite;
+bool key_pressed(ALLEGRO_EVENT event, int key_code) {
+    return event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == key_code;
 }
 
 /**
- * @breif Verifica se uma determinada tecla do teclado foi pressionada.
+ * @brief Verifica se uma determinada tecla do teclado foi solta.
  * 
  * @param event O evento disparado.
  * @param key_code Representando o codigo da tecla a ser verificada.
  * 
- * @return Bool indicando se a tecla foi pressionada.
+ * @return Bool indicando se a tecla foi solta.
  */
-bool key_pressed(ALLEGRO_EVENT event, int key_code) {
-    return event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == key_code;
+bool key_released(ALLEGRO_EVENT event, int key_code) {
+    return event.type == ALLEGRO_EVENT_KEY_UP && event.keyboard.keycode == key_code;
 }
 
 /**
@@ -161,37 +206,51 @@ void trim_space(char *str) {
 }
 
 /**
- * @brief Desenha um texto dentro de um limite de comprimento, 
- * caso a linha for maior, quebra essa linha e continua o desenho.
+ * @brief Adiciona uma linha ao layout de um texto.
  * 
- * @param font Ponteiro para a ALLEGRO_FONT a ser usada para desenhar o texto.
- * @param color ALLEGRO_COLOR a ser usada para o texto.
- * @param x Coordenada horizontal de onde começar a desenhar.
- * @param y Coordenada vertical de onde começar a desenhar.
- * @param max_width Comprimento máximo da linha.
- * @param text Texto a ser escrito.
- * @param gap Espaço entre cada linha do texto.
+ * @param layout Ponteiro para TextLayout.
+ * @param line Texto da linha.
+ * @param offset Posição vertical da linha relativa ao início do texto.
+ * @param used Ponteiro para a quantidade de bytes já usados em layout->lines.
+ */
+void add_text_layout_line(TextLayout *layout, const char *line, float offset, int *used) {
+    if (layout->line_count >= TEXT_LAYOUT_MAX_LINES) return;
+
+    int length = snprintf(layout->lines + *used, sizeof(layout->lines) - *used, "%s", line);
+
+    layout->line_starts[layout->line_count] = *used;
+    layout->line_offsets[layout->line_count] = offset;
+    layout->line_count++;
+    *used += length + 1;
+}
+
+/**
+ * @brief Calcula a quebra de linhas de um texto, uma linha é quebrada quando a próxima 
+ * palavra faria ela passar do comprimento máximo.
  * 
+ * @param layout Ponteiro para TextLayout com font, max_width, gap e text preenchidos.
  */
-void draw_wrapped_text(ALLEGRO_FONT *font, ALLEGRO_COLOR color, 
-                        float x, float y, float max_width, const char *text, int gap) {
-    char buffer[1024];
-    strcpy(buffer, text);
+void build_text_layout(TextLayout *layout) {
+    char buffer[TEXT_LAYOUT_MAX_TEXT];
+    strcpy(buffer, layout->text);
     char *token = strtok(buffer, " ");
-    char line[1024] = "";
+    char line[TEXT_LAYOUT_MAX_TEXT] = "";
+    int used = 0;
 
-    float line_height = al_get_font_line_height(font);
-    float current_y = y;
+    float line_height = al_get_font_line_height(layout->font);
+    float current_y = 0;
+
+    layout->line_count = 0;
 
     while(token != NULL) {
-        char temp_line[1025];
+        char temp_line[TEXT_LAYOUT_MAX_TEXT + 1];
         snprintf(temp_line, sizeof(temp_line), "%s %s", line, token);
 
-        if (al_get_text_width(font, temp_line) > max_width) {
+        if (al_get_text_width(layout->font, temp_line) > layout->max_width) {
             trim_space(line);
-            al_draw_text(font, color, x, current_y, ALLEGRO_ALIGN_CENTER, line);
+            add_text_layout_line(layout, line, current_y, &used);
             strcpy(line, token);
-            current_y += line_height + gap;
+            current_y += line_height + layout->gap;
         } else {
             strcpy(line, temp_line);
         }
@@ -199,7 +258,60 @@ void draw_wrapped_text(ALLEGRO_FONT *font, ALLEGRO_COLOR color,
         token = strtok(NULL, " ");
     }
 
-    al_draw_text(font, color, x, current_y, ALLEGRO_ALIGN_CENTER, line);
+    add_text_layout_line(layout, line, current_y, &used);
+}
+
+/**
+ * @brief Retorna o layout de um texto, calculando-o somente na primeira vez que a combinação 
+ * de fonte, texto, largura e espaçamento é usada. O cache guarda os TEXT_LAYOUT_CACHE_SIZE 
+ * layouts mais recentes.
+ * 
+ * @return Ponteiro para TextLayout.
+ */
+const TextLayout *get_text_layout(ALLEGRO_FONT *font, float max_width, const char *text, int gap) {
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++) {
+        TextLayout *layout = &text_layouts[i];
+
+        if (layout->font == font && layout->max_width == max_width && layout->gap == gap &&
+            strcmp(layout->text, text) == 0)
+            return layout;
+    }
+
+    TextLayout *layout = &text_layouts[next_text_layout];
+    next_text_layout = (next_text_layout + 1) % TEXT_LAYOUT_CACHE_SIZE;
+
+    layout->font = font;
+    layout->max_width = max_width;
+    layout->gap = gap;
+    snprintf(layout->text, sizeof(layout->text), "%s", text);
+    build_text_layout(layout);
+
+    return layout;
+}
+
+/**
+ * @brief Desenha um texto dentro de um limite de comprimento, 
+ * caso a linha for maior, quebra essa linha e continua o desenho.
+ * A quebra de linhas vem do cache de layouts, então nos frames seguintes 
+ * o texto não é medido nem copiado.
+ * 
+ * @param font Ponteiro para a ALLEGRO_FONT a ser usada para desenhar o texto.
+ * @param color ALLEGRO_COLOR a ser usada para o texto.
+ * @param x Coordenada horizontal de onde começar a desenhar.
+ * @param y Coordenada vertical de onde começar a desenhar.
+ * @param max_width Comprimento máximo da linha.
+ * @param text Texto a ser escrito.
+ * @param gap Espaço entre cada linha do texto.
+ * 
+ */
+void draw_wrapped_text(ALLEGRO_FONT *font, ALLEGRO_COLOR color, 
+                        float x, float y, float max_width, const char *text, int gap) {
+    const TextLayout *layout = get_text_layout(font, max_width, text, gap);
+
+    for (int i = 0; i < layout->line_count; i++) {
+        al_draw_text(font, color, x, y + layout->line_offsets[i], ALLEGRO_ALIGN_CENTER, 
+            layout->lines + layout->line_starts[i]);
+    }
 }
 
 /**
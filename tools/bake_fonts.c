@@ -0,0 +1,155 @@
+#include "font_manager.h"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <allegro5/allegro_ttf.h>
+#include <allegro5/allegro_image.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#define ATLAS_MAX_WIDTH 512
+
+/**
+ * @brief Calcula a altura do atlas de uma fonte, com os glifos em linhas de até ATLAS_MAX_WIDTH 
+ * pixels e uma borda de um pixel em volta de cada glifo.
+ *
+ * @param font Fonte TTF.
+ *
+ * @return Altura do atlas em pixels.
+ */
+int get_atlas_height(ALLEGRO_FONT *font) {
+    int line_height = al_get_font_line_height(font);
+    int x = 1, y = 1;
+
+    for (int c = FONT_ATLAS_FIRST_GLYPH; c <= FONT_ATLAS_LAST_GLYPH; c++) {
+        int width = al_get_glyph_advance(font, c, ALLEGRO_NO_KERNING);
+
+        if (x + width + 1 > ATLAS_MAX_WIDTH) {
+            x = 1;
+            y += line_height + 1;
+        }
+
+        x += width + 1;
+    }
+
+    return y + line_height + 1;
+}
+
+/**
+ * @brief Converte os pixels do atlas de alfa pré-multiplicado para alfa normal, que é o formato 
+ * esperado em um PNG (o allegro pré-multiplica de novo ao carregar).
+ *
+ * @param atlas Bitmap do atlas.
+ */
+void unpremultiply_atlas(ALLEGRO_BITMAP *atlas) {
+    ALLEGRO_LOCKED_REGION *region = al_lock_bitmap(atlas, ALLEGRO_PIXEL_FORMAT_ABGR_8888, ALLEGRO_LOCK_READWRITE);
+    int width = al_get_bitmap_width(atlas), height = al_get_bitmap_height(atlas);
+
+    for (int y = 0; y < height; y++) {
+        uint8_t *pixel = (uint8_t *) region->data + y * region->pitch;
+
+        for (int x = 0; x < width; x++, pixel += 4) {
+            if (pixel[3] == 0 || pixel[3] == 255) continue;
+
+            for (int c = 0; c < 3; c++)
+                pixel[c] = (uint8_t) (pixel[c] * 255 / pixel[3]);
+        }
+    }
+
+    al_unlock_bitmap(atlas);
+}
+
+/**
+ * @brief Gera o atlas de uma fonte em um tamanho, no formato lido por al_grab_font_from_bitmap: 
+ * cada glifo ocupa uma caixa transparente com a largura de avanço do glifo e a altura da linha, 
+ * separada das outras por uma borda da cor do pixel (0, 0). Os glifos são desenhados em branco para
+ * poderem ser coloridos por al_draw_text.
+ *
+ * @param spec Ponteiro para FontSpec.
+ * @param size Tamanho da fonte.
+ *
+ * @return Bool indicando se o atlas foi gravado.
+ */
+bool bake_font_atlas(const FontSpec *spec, int size) {
+    char path[PATH_MAX];
+    ALLEGRO_FONT *font = al_load_ttf_font(spec->path, size, 0);
+
+    if (!font) {
+        fprintf(stderr, "Failed to load font in path: %s\n", spec->path);
+        return false;
+    }
+
+    int line_height = al_get_font_line_height(font);
+    ALLEGRO_BITMAP *atlas = al_create_bitmap(ATLAS_MAX_WIDTH, get_atlas_height(font));
+
+    if (!atlas) {
+        fprintf(stderr, "Failed to create font atlas.\n");
+        al_destroy_font(font);
+        return false;
+    }
+
+    al_set_target_bitmap(atlas);
+    al_clear_to_color(al_map_rgb(255, 255, 0));
+
+    int x = 1, y = 1;
+
+    for (int c = FONT_ATLAS_FIRST_GLYPH; c <= FONT_ATLAS_LAST_GLYPH; c++) {
+        int width = al_get_glyph_advance(font, c, ALLEGRO_NO_KERNING);
+
+        if (x + width + 1 > ATLAS_MAX_WIDTH) {
+            x = 1;
+            y += line_height + 1;
+        }
+
+        al_set_clipping_rectangle(x, y, width, line_height);
+        al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+        al_draw_glyph(font, al_map_rgb(255, 255, 255), x, y, c);
+        x += width + 1;
+    }
+
+    al_reset_clipping_rectangle();
+    unpremultiply_atlas(atlas);
+    get_font_atlas_path(path, spec->name, size);
+
+    bool saved = al_save_bitmap(path, atlas);
+
+    if (saved)
+        printf("Baked %s (%d px) into %s.\n", spec->path, size, path);
+    else
+        fprintf(stderr, "Failed to save font atlas in path: %s\n", path);
+
+    al_destroy_bitmap(atlas);
+    al_destroy_font(font);
+
+    return saved;
+}
+
+/**
+ * @brief Ferramenta de build: gera os atlas de glifos de todas as fontes em todos os tamanhos usados
+ * pelo game, assim o game não precisa do FreeType nem rasteriza glifos durante a partida.
+ */
+int main() {
+    int count, failures = 0;
+    const FontSpec *specs = get_font_specs(&count);
+
+    if (!al_init() || !al_init_font_addon() || !al_init_ttf_addon() || !al_init_image_addon()) {
+        fprintf(stderr, "Failed to init Allegro5 addons.\n");
+        return -1;
+    }
+
+    if (mkdir(FONT_ATLAS_DIR, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Unable to create font atlas dir %s.\n", FONT_ATLAS_DIR);
+        return -1;
+    }
+
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+    for (int i = 0; i < count; i++) {
+        for (int s = 0; s < FONT_SIZES; s++)
+            failures += !bake_font_atlas(&specs[i], specs[i].sizes[s]);
+    }
+
+    return failures == 0 ? 0 : -1;
+}